@@ -44,6 +44,15 @@
 #include <boost/decimal/dpd_conversion.hpp>
 #include <boost/decimal/string.hpp>
 #include <boost/decimal/uint128_t.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/decimal_multiplier.hpp>
+#include <boost/decimal/decimal_divider.hpp>
+#include <boost/decimal/decimal_column.hpp>
+#include <boost/decimal/decimal_accumulator.hpp>
+#include <boost/decimal/rounded_decimal.hpp>
+#include <boost/decimal/unchecked.hpp>
+#include <boost/decimal/fixed_decimal.hpp>
+#include <boost/decimal/lazy_expression.hpp>
 
 #if defined(__clang__) && !defined(__GNUC__)
 #  pragma clang diagnostic pop
@@ -0,0 +1,244 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_BATCH_HPP
+#define BOOST_DECIMAL_BATCH_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/normalize.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+#include <span>
+#endif
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Number of lanes processed together.
+// Each block is first scanned for non-finite values with a branch-free pass,
+// which allows the arithmetic on the block to skip all NaN and infinity handling.
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE std::size_t batch_block_size {64U};
+
+template <typename T>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto batch_has_non_finite(const T* a, const T* b, const std::size_t n) noexcept -> bool
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    unsigned special {};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        special |= static_cast<unsigned>(not_finite(a[i])) | static_cast<unsigned>(not_finite(b[i]));
+    }
+
+    return special != 0U;
+    #else
+    static_cast<void>(a);
+    static_cast<void>(b);
+    static_cast<void>(n);
+    return false;
+    #endif
+}
+
+template <typename T>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto batch_has_non_finite(const T* a, const std::size_t n) noexcept -> bool
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    unsigned special {};
+    for (std::size_t i {}; i < n; ++i)
+    {
+        special |= static_cast<unsigned>(!isfinite(a[i]));
+    }
+
+    return special != 0U;
+    #else
+    static_cast<void>(a);
+    static_cast<void>(n);
+    return false;
+    #endif
+}
+
+// Decodes the BID word, selecting between the two encodings of the
+// significand and exponent without branching
+BOOST_DECIMAL_FORCE_INLINE constexpr auto batch_unpack(const decimal64_t val) noexcept -> decimal64_t_components
+{
+    constexpr std::uint64_t implied_bit {UINT64_C(0x20000000000000)};
+
+    const auto bits {to_bits(val)};
+    const bool is_11 {(bits & d64_combination_field_mask) == d64_combination_field_mask};
+
+    const auto sig_11 {implied_bit | (bits & d64_11_significand_mask)};
+    const auto sig_not_11 {bits & d64_not_11_significand_mask};
+    const auto exp_11 {(bits & d64_11_exp_mask) >> d64_11_exp_shift};
+    const auto exp_not_11 {(bits & d64_not_11_exp_mask) >> d64_not_11_exp_shift};
+
+    return {is_11 ? sig_11 : sig_not_11,
+            static_cast<std::int32_t>(is_11 ? exp_11 : exp_not_11) - bias_v<decimal64_t>,
+            (bits & d64_sign_mask) != 0U};
+}
+
+template <bool is_subtraction>
+constexpr auto batch_add_sub_block(const decimal64_t* a, const decimal64_t* b, decimal64_t* out, const std::size_t n) noexcept -> void
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        // Matches the scalar operators, which first try the sum directly on the encodings
+        std::uint64_t bits {};
+        const auto rhs_bits {is_subtraction ? to_bits(b[i]) ^ d64_sign_mask : to_bits(b[i])};
+        if (bid_same_quantum_add<std::uint64_t, d64_not_11_significand_mask>(to_bits(a[i]), rhs_bits, bits))
+        {
+            out[i] = from_bits(bits);
+            continue;
+        }
+
+        auto lhs {batch_unpack(a[i])};
+        auto rhs {batch_unpack(b[i])};
+        rhs.sign = rhs.sign != is_subtraction;
+
+        expand_significand<decimal64_t>(lhs.sig, lhs.exp);
+        expand_significand<decimal64_t>(rhs.sig, rhs.exp);
+        out[i] = add_impl<decimal64_t>(lhs, rhs);
+    }
+}
+
+// The fast type is stored unpacked so only the non-finite handling is removed from the loop
+template <bool is_subtraction>
+constexpr auto batch_add_sub_block(const decimal_fast64_t* a, const decimal_fast64_t* b, decimal_fast64_t* out, const std::size_t n) noexcept -> void
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        BOOST_DECIMAL_IF_CONSTEXPR (is_subtraction)
+        {
+            out[i] = add_impl<decimal_fast64_t>(a[i], -b[i]);
+        }
+        else
+        {
+            out[i] = add_impl<decimal_fast64_t>(a[i], b[i]);
+        }
+    }
+}
+
+template <bool is_subtraction, typename T>
+constexpr auto batch_add_sub_scalar(const T* a, const T* b, T* out, const std::size_t n) noexcept -> void
+{
+    for (std::size_t i {}; i < n; ++i)
+    {
+        BOOST_DECIMAL_IF_CONSTEXPR (is_subtraction)
+        {
+            out[i] = a[i] - b[i];
+        }
+        else
+        {
+            out[i] = a[i] + b[i];
+        }
+    }
+}
+
+template <bool is_subtraction, typename T>
+constexpr auto batch_add_sub_impl(const T* a, const T* b, T* out, const std::size_t n) noexcept
+    -> std::enable_if_t<std::is_same<T, decimal64_t>::value || std::is_same<T, decimal_fast64_t>::value, void>
+{
+    std::size_t i {};
+    while (i < n)
+    {
+        const auto block {n - i < batch_block_size ? n - i : batch_block_size};
+
+        // Blocks containing an infinity or NaN take the scalar path,
+        // so the kernel only ever has to deal with finite values
+        if (BOOST_DECIMAL_UNLIKELY(batch_has_non_finite(a + i, b + i, block)))
+        {
+            batch_add_sub_scalar<is_subtraction>(a + i, b + i, out + i, block);
+        }
+        else
+        {
+            batch_add_sub_block<is_subtraction>(a + i, b + i, out + i, block);
+        }
+
+        i += block;
+    }
+}
+
+template <bool is_subtraction, typename T>
+constexpr auto batch_add_sub_impl(const T* a, const T* b, T* out, const std::size_t n) noexcept
+    -> std::enable_if_t<!(std::is_same<T, decimal64_t>::value || std::is_same<T, decimal_fast64_t>::value), void>
+{
+    batch_add_sub_scalar<is_subtraction>(a, b, out, n);
+}
+
+} // namespace detail
+
+// Computes out[i] = a[i] + b[i] for i in [0, n)
+// The results are identical to those of the scalar operator+.
+// out may be the same array as a or b, but must not otherwise overlap either of them.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto add(const DecimalType* a, const DecimalType* b, DecimalType* out, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::batch_add_sub_impl<false>(a, b, out, n);
+}
+
+// Computes out[i] = a[i] - b[i] for i in [0, n)
+// The results are identical to those of the scalar operator-.
+// out may be the same array as a or b, but must not otherwise overlap either of them.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto sub(const DecimalType* a, const DecimalType* b, DecimalType* out, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    detail::batch_add_sub_impl<true>(a, b, out, n);
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// The three sizes must be equal, as asserted in debug builds.
+// If they are not, only the smallest of them is processed, so that no span is accessed past its end.
+// DecimalType is deduced from out alone, so a and b can be any contiguous range that converts to std::span<const DecimalType>,
+// such as std::span<DecimalType> or std::vector<DecimalType>.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto add(std::span<const detail::type_identity_t<DecimalType>> a, std::span<const detail::type_identity_t<DecimalType>> b,
+                   std::span<DecimalType> out) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(a.size() == out.size() && b.size() == out.size());
+
+    auto n {out.size()};
+    n = a.size() < n ? a.size() : n;
+    n = b.size() < n ? b.size() : n;
+
+    detail::batch_add_sub_impl<false>(a.data(), b.data(), out.data(), n);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto sub(std::span<const detail::type_identity_t<DecimalType>> a, std::span<const detail::type_identity_t<DecimalType>> b,
+                   std::span<DecimalType> out) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, void)
+{
+    BOOST_DECIMAL_ASSERT(a.size() == out.size() && b.size() == out.size());
+
+    auto n {out.size()};
+    n = a.size() < n ? a.size() : n;
+    n = b.size() < n ? b.size() : n;
+
+    detail::batch_add_sub_impl<true>(a.data(), b.data(), out.data(), n);
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_BATCH_HPP
@@ -72,7 +72,7 @@ BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto _boost_decimal_global_rounding_mode
     #elif defined(BOOST_DECIMAL_FE_DEC_TO_NEAREST_FROM_ZERO)
     rounding_mode::fe_dec_to_nearest_from_zero
     #elif defined (BOOST_DECIMAL_FE_DEC_TOWARD_ZERO)
-    rounding_mde::fe_dec_toward_zero
+    rounding_mode::fe_dec_toward_zero
     #elif defined(BOOST_DECIMAL_FE_DEC_UPWARD)
     rounding_mode::fe_dec_upward
     #else
@@ -80,7 +80,9 @@ BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto _boost_decimal_global_rounding_mode
     #endif
 };
 
-BOOST_DECIMAL_INLINE_VARIABLE auto _boost_decimal_global_runtime_rounding_mode {_boost_decimal_global_rounding_mode};
+// Each thread starts in the compile time rounding mode, and changes to it only affect the calling thread.
+// It is initialized with a constant so reading it does not go through a thread local initialization guard.
+BOOST_DECIMAL_INLINE_VARIABLE BOOST_DECIMAL_THREAD_LOCAL auto _boost_decimal_global_runtime_rounding_mode {_boost_decimal_global_rounding_mode};
 
 BOOST_DECIMAL_EXPORT inline auto fegetround() noexcept -> rounding_mode
 {
@@ -100,6 +102,113 @@ BOOST_DECIMAL_EXPORT inline auto fesetround(BOOST_DECIMAL_ATTRIBUTE_UNUSED const
     return _boost_decimal_global_runtime_rounding_mode;
 }
 
+// Sets the rounding mode of the calling thread for the lifetime of the object,
+// and restores the mode that was active before on destruction
+BOOST_DECIMAL_EXPORT class rounding_scope
+{
+private:
+    rounding_mode previous_;
+
+public:
+    explicit rounding_scope(const rounding_mode round) noexcept : previous_ {fegetround()}
+    {
+        fesetround(round);
+    }
+
+    ~rounding_scope() noexcept
+    {
+        fesetround(previous_);
+    }
+
+    rounding_scope(const rounding_scope&) = delete;
+    rounding_scope& operator=(const rounding_scope&) = delete;
+
+    // The mode that will be restored
+    auto previous() const noexcept -> rounding_mode
+    {
+        return previous_;
+    }
+};
+
+// The exceptions of IEEE 754 section 7, which are recorded in sticky status flags
+BOOST_DECIMAL_EXPORT enum class status_flags : unsigned
+{
+    fe_dec_invalid = 1 << 0,
+    fe_dec_divbyzero = 1 << 1,
+    fe_dec_overflow = 1 << 2,
+    fe_dec_underflow = 1 << 3,
+    fe_dec_inexact = 1 << 4,
+    fe_dec_all_except = fe_dec_invalid | fe_dec_divbyzero | fe_dec_overflow | fe_dec_underflow | fe_dec_inexact
+};
+
+BOOST_DECIMAL_EXPORT constexpr auto operator|(const status_flags lhs, const status_flags rhs) noexcept -> status_flags
+{
+    return static_cast<status_flags>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto operator&(const status_flags lhs, const status_flags rhs) noexcept -> status_flags
+{
+    return static_cast<status_flags>(static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs));
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto operator^(const status_flags lhs, const status_flags rhs) noexcept -> status_flags
+{
+    return static_cast<status_flags>(static_cast<unsigned>(lhs) ^ static_cast<unsigned>(rhs));
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto operator~(const status_flags rhs) noexcept -> status_flags
+{
+    return static_cast<status_flags>(~static_cast<unsigned>(rhs)) & status_flags::fe_dec_all_except;
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto operator|=(status_flags& lhs, const status_flags rhs) noexcept -> status_flags&
+{
+    lhs = lhs | rhs;
+    return lhs;
+}
+
+BOOST_DECIMAL_EXPORT constexpr auto operator&=(status_flags& lhs, const status_flags rhs) noexcept -> status_flags&
+{
+    lhs = lhs & rhs;
+    return lhs;
+}
+
+namespace detail {
+
+// The flags belong to the calling thread like the rounding mode.
+// Operations only raise them when BOOST_DECIMAL_ENABLE_STATUS_FLAGS is defined, otherwise they cost nothing.
+// Before C++17 a variable at namespace scope would be static, giving each translation unit its own flags,
+// whereas the static variables of an inline function are shared by the whole program.
+inline auto thread_status_flags() noexcept -> status_flags&
+{
+    static BOOST_DECIMAL_THREAD_LOCAL status_flags flags {};
+    return flags;
+}
+
+} // namespace detail
+
+// Returns which of excepts are currently raised
+BOOST_DECIMAL_EXPORT inline auto fetestexcept(const status_flags excepts) noexcept -> status_flags
+{
+    return detail::thread_status_flags() & excepts;
+}
+
+// Lowers excepts and returns the flags which remain raised
+BOOST_DECIMAL_EXPORT inline auto feclearexcept(const status_flags excepts) noexcept -> status_flags
+{
+    auto& flags {detail::thread_status_flags()};
+    flags &= ~excepts;
+    return flags;
+}
+
+// Raises excepts and returns all the flags which are raised
+BOOST_DECIMAL_EXPORT inline auto feraiseexcept(const status_flags excepts) noexcept -> status_flags
+{
+    auto& flags {detail::thread_status_flags()};
+    flags |= excepts;
+    return flags;
+}
+
 } // namespace decimal
 } // namespace boost
 
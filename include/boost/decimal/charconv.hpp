@@ -11,6 +11,7 @@
 #include <boost/decimal/decimal_fast32_t.hpp>
 #include <boost/decimal/decimal_fast64_t.hpp>
 #include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/fixed_decimal.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/parser.hpp>
 #include <boost/decimal/detail/utilities.hpp>
@@ -1295,6 +1296,97 @@ constexpr auto to_chars(char* first, char* last, DecimalType value, std::chars_f
 
 #endif // BOOST_DECIMAL_HAS_STD_CHARCONV
 
+// ---------------------------------------------------------------------------------------------------------------------
+// fixed_decimal
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Writes the value as [-]integer.fraction with exactly Scale digits after the decimal point
+BOOST_DECIMAL_EXPORT template <int Scale, typename Rep>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto to_chars(char* first, char* last, const fixed_decimal<Scale, Rep>& value) noexcept -> to_chars_result
+{
+    using unsigned_rep = detail::make_unsigned_t<Rep>;
+
+    constexpr auto factor {detail::pow10(static_cast<unsigned_rep>(Scale))};
+
+    if (first >= last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    if (value.raw() < 0)
+    {
+        *first++ = '-';
+    }
+
+    auto fraction {detail::make_positive_unsigned(value.raw())};
+    auto r {detail::to_chars_integer_impl(first, last, fraction / factor)};
+
+    BOOST_DECIMAL_IF_CONSTEXPR (Scale > 0)
+    {
+        if (r.ec != std::errc() || last - r.ptr < Scale + 1)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        *r.ptr = '.';
+        fraction %= factor;
+        for (int i {Scale}; i > 0; --i)
+        {
+            r.ptr[i] = static_cast<char>('0' + fraction % 10U);
+            fraction /= 10U;
+        }
+
+        r.ptr += Scale + 1;
+    }
+
+    return r;
+}
+
+// The other formats are those of the exact decimal128_t value
+BOOST_DECIMAL_EXPORT template <int Scale, typename Rep>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto to_chars(char* first, char* last, const fixed_decimal<Scale, Rep>& value, const chars_format fmt) noexcept -> to_chars_result
+{
+    return detail::to_chars_impl(first, last, static_cast<decimal128_t>(value), fmt);
+}
+
+BOOST_DECIMAL_EXPORT template <int Scale, typename Rep>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto to_chars(char* first, char* last, const fixed_decimal<Scale, Rep>& value, const chars_format fmt, int precision) noexcept -> to_chars_result
+{
+    if (precision < 0)
+    {
+        precision = 6;
+    }
+
+    return detail::to_chars_impl(first, last, static_cast<decimal128_t>(value), fmt, precision);
+}
+
+// Parses as decimal128_t and rounds to Scale digits in the current rounding mode.
+// Inputs with more than the 34 significant digits of decimal128_t are rounded to 34 digits first,
+// so they can be rounded twice, e.g. 1.014999... with 35 or more digits gives 1.02 for Scale 2.
+// NaN and infinity give std::errc::invalid_argument, and values out of range std::errc::result_out_of_range,
+// in which case value is unchanged.
+BOOST_DECIMAL_EXPORT template <int Scale, typename Rep>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto from_chars(const char* first, const char* last, fixed_decimal<Scale, Rep>& value, const chars_format fmt = chars_format::general) noexcept -> from_chars_result
+{
+    decimal128_t parsed {};
+    auto r {detail::from_chars_general_impl(first, last, parsed, fmt)};
+
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    Rep raw {};
+    if (!detail::fixed_from_decimal<Scale>(parsed, raw))
+    {
+        r.ec = isfinite(parsed) ? std::errc::result_out_of_range : std::errc::invalid_argument;
+        return r;
+    }
+
+    value = fixed_decimal<Scale, Rep>::from_raw(raw);
+    return r;
+}
+
 } //namespace decimal
 } //namespace boost
 
@@ -203,6 +203,9 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
+    template <typename DecimalType>
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::get_components(const DecimalType& val) noexcept -> detail::components_type<DecimalType>;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
@@ -714,7 +717,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal128_t::decimal128_t(T1 coeff, T2 exp, const
         // NVCC can't access uint128_t variables since it's a non-trivial struct.
         // We need to call the related function and store the result instead.
         constexpr auto max_sig {detail::impl::max_significand_v<decimal128_t>()};
-        if (coeff > max_sig || biased_exp < -(detail::precision_v<decimal128_t> - 1))
+        if (coeff > max_sig || biased_exp < 0)
         {
             coeff_digits = detail::coefficient_rounding<decimal128_t>(coeff, exp, biased_exp, is_negative, detail::num_digits(coeff));
         }
@@ -766,6 +769,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal128_t::decimal128_t(T1 coeff, T2 exp, const
         if (biased_exp < 0 && coeff_digits == 1)
         {
             // This needs to be flushed to 0 or rounded to subnormal min
+            detail::raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
             rounding_mode current_round_mode {_boost_decimal_global_rounding_mode};
 
             #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
@@ -839,12 +843,13 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal128_t::decimal128_t(T1 coeff, T2 exp, const
                 {
                     // Need to ensure that we are following the current global rounding mode when packing subnormals
                     const auto shift_pow_10 {detail::pow10(static_cast<significand_type>(pos_biased_exp - 1))};
-                    const auto div_res {detail::impl::divmod(reduced_coeff, shift_pow_10)};
+                    const auto div_res {detail::impl::divmod_pow10(reduced_coeff, pos_biased_exp - 1, shift_pow_10)};
                     reduced_coeff = div_res.quotient;
                     sticky = div_res.remainder != 0U;
                 }
                 // We may have to round the value so that it fits correctly
                 // e.g. 13e-399 -> 1e-398
+                detail::raise_rounding_status(reduced_coeff, sticky, true);
                 detail::fenv_round<decimal128_t>(reduced_coeff, is_negative, sticky);
             }
 
@@ -860,6 +865,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal128_t::decimal128_t(T1 coeff, T2 exp, const
         }
         else
         {
+            detail::raise_status(exp < 0 ? status_flags::fe_dec_underflow | status_flags::fe_dec_inexact :
+                                           status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
             bits_ = exp < 0 ? zero : detail::d128_inf_mask;
             bits_.high |= is_negative ? detail::d128_sign_mask : UINT64_C(0);
         }
@@ -1331,6 +1338,10 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator<(const decimal128_t& lhs, const decim
         {
             return !rhs.isneg();
         }
+        if (isinf(lhs))
+        {
+            return lhs.isneg() && isfinite(rhs);
+        }
     }
     #endif
 
@@ -1569,6 +1580,11 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_div_impl(const decimal128_t& lhs, const d
     {
         if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
         {
+            if (issignaling(lhs) || issignaling(rhs))
+            {
+                detail::raise_status(status_flags::fe_dec_invalid);
+            }
+
             // Operations on an SNAN return a QNAN with the same payload
             decimal128_t return_nan {};
             if (lhs_fp == rhs_fp)
@@ -1606,6 +1622,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_div_impl(const decimal128_t& lhs, const d
             case FP_INFINITE:
                 if (rhs_fp == FP_INFINITE)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1618,6 +1635,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_div_impl(const decimal128_t& lhs, const d
             case FP_ZERO:
                 if (rhs_fp == FP_ZERO)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1634,6 +1652,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_div_impl(const decimal128_t& lhs, const d
         switch (rhs_fp)
         {
             case FP_ZERO:
+                detail::raise_status(status_flags::fe_dec_divbyzero);
                 q = inf;
                 r = zero;
                 return;
@@ -1677,6 +1696,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal128_t& lhs, const decim
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) != signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d128_nan_mask);
         }
         
@@ -1684,12 +1704,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal128_t& lhs, const decim
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::expand_significand<decimal128_t>(lhs_components.sig, lhs_components.exp);
-    auto rhs_components {rhs.to_components()};
-    detail::expand_significand<decimal128_t>(rhs_components.sig, rhs_components.exp);
-
-    return detail::d128_add_impl_new<decimal128_t>(lhs_components, rhs_components);
+    return detail::d128_add_impl_narrow<decimal128_t>(lhs.to_components(), rhs.to_components());
 }
 
 template <typename Integer>
@@ -1706,15 +1721,17 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal128_t lhs, const Intege
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::expand_significand<decimal128_t>(lhs_components.sig, lhs_components.exp);
-
+    // The integer is an unnormalized significand with exponent 0,
+    // which d128_add_impl_narrow adds directly unless it has more than 18 digits
     auto positive_rhs {static_cast<sig_type>(detail::make_positive_unsigned(rhs))};
     exp_type exp_rhs {0};
-    detail::normalize<decimal128_t>(positive_rhs, exp_rhs);
+    BOOST_DECIMAL_IF_CONSTEXPR (sizeof(Integer) > sizeof(std::uint64_t))
+    {
+        detail::normalize<decimal128_t>(positive_rhs, exp_rhs);
+    }
     const detail::decimal128_t_components rhs_components {positive_rhs, exp_rhs, rhs < 0};
 
-    return detail::d128_add_impl_new<decimal128_t>(lhs_components, rhs_components);
+    return detail::d128_add_impl_narrow<decimal128_t>(lhs.to_components(), rhs_components);
 }
 
 template <typename Integer>
@@ -1732,6 +1749,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal128_t& lhs, const decim
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d128_nan_mask);
         }
         if (isinf(rhs) && !isnan(lhs))
@@ -1743,13 +1761,10 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal128_t& lhs, const decim
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::expand_significand<decimal128_t>(lhs_components.sig, lhs_components.exp);
     auto rhs_components {rhs.to_components()};
-    detail::expand_significand<decimal128_t>(rhs_components.sig, rhs_components.exp);
     rhs_components.sign = !rhs_components.sign;
 
-    return detail::d128_add_impl_new<decimal128_t>(lhs_components, rhs_components);
+    return detail::d128_add_impl_narrow<decimal128_t>(lhs.to_components(), rhs_components);
 }
 
 template <typename Integer>
@@ -1766,15 +1781,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal128_t lhs, const Intege
     }
     #endif
 
-    auto lhs_components {lhs.to_components()};
-    detail::expand_significand<decimal128_t>(lhs_components.sig, lhs_components.exp);
-
     auto sig_rhs {static_cast<sig_type>(detail::make_positive_unsigned(rhs))};
     exp_type exp_rhs {0};
-    detail::normalize<decimal128_t>(sig_rhs, exp_rhs);
+    BOOST_DECIMAL_IF_CONSTEXPR (sizeof(Integer) > sizeof(std::uint64_t))
+    {
+        detail::normalize<decimal128_t>(sig_rhs, exp_rhs);
+    }
     const detail::decimal128_t_components rhs_components {sig_rhs, exp_rhs, !(rhs < 0)};
 
-    return detail::d128_add_impl_new<decimal128_t>(lhs_components, rhs_components);
+    return detail::d128_add_impl_narrow<decimal128_t>(lhs.to_components(), rhs_components);
 }
 
 template <typename Integer>
@@ -1803,6 +1818,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal128_t& lhs, const decim
     {
         if ((isinf(lhs) && rhs == 0) || (isinf(rhs) && lhs == 0))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d128_nan_mask);
         }
         else if (isinf(lhs) && !isnan(rhs) && (signbit(lhs) != signbit(rhs)))
@@ -1856,21 +1872,14 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal128_t lhs, const Intege
     }
     #endif
 
-    auto lhs_sig {lhs.full_significand()};
-    auto lhs_exp {lhs.biased_exponent()};
-    const auto lhs_zeros {detail::remove_trailing_zeros(lhs_sig)};
-    lhs_sig = lhs_zeros.trimmed_number;
-    lhs_exp += static_cast<std::int32_t>(lhs_zeros.number_of_removed_zeros);
-
-    auto rhs_sig {static_cast<int128::uint128_t>(detail::make_positive_unsigned(rhs))};
-    const auto rhs_zeros {detail::remove_trailing_zeros(rhs_sig)};
-    rhs_sig = rhs_zeros.trimmed_number;
-    const auto rhs_exp = static_cast<exp_type>(rhs_zeros.number_of_removed_zeros);
+    // The integer is used directly as a significand with exponent 0. A product of significands
+    // of up to 64 bits is a single 64x64 -> 128-bit multiplication in d128_mul_impl.
+    const auto lhs_components {lhs.to_components()};
+    const auto rhs_sig {static_cast<int128::uint128_t>(detail::make_positive_unsigned(rhs))};
 
     return detail::d128_mul_impl<decimal128_t>(
-            lhs_sig, lhs_exp, lhs.isneg(),
-            rhs_sig, rhs_exp, (rhs < 0));
-
+            lhs_components.sig, lhs_components.exp, lhs_components.sign,
+            rhs_sig, exp_type{0}, (rhs < 0));
 }
 
 template <typename Integer>
@@ -1893,19 +1902,19 @@ template <typename Integer>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal128_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal128_t)
 {
+    const bool sign {lhs.isneg() != (rhs < 0)};
+
     #ifndef BOOST_DECIMAL_FAST_MATH
     // Check pre-conditions
     constexpr decimal128_t zero {0, 0};
     constexpr decimal128_t inf {from_bits(detail::d128_inf_mask)};
 
-    const bool sign {lhs.isneg() != (rhs < 0)};
-
     const auto lhs_fp {fpclassify(lhs)};
 
     switch (lhs_fp)
     {
         case FP_NAN:
-            return issignaling(lhs) ? nan_conversion(lhs) : lhs;
+            return detail::check_non_finite(lhs);
         case FP_INFINITE:
             return sign ? -lhs : lhs;
         case FP_ZERO:
@@ -1916,6 +1925,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal128_t lhs, const Intege
 
     if (rhs == 0)
     {
+        detail::raise_status(status_flags::fe_dec_divbyzero);
         return sign ? -inf : inf;
     }
     #endif
@@ -1923,12 +1933,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal128_t lhs, const Intege
     auto lhs_components {lhs.to_components()};
     detail::expand_significand<decimal128_t>(lhs_components.sig, lhs_components.exp);
 
-    const detail::decimal128_t_components rhs_components {detail::make_positive_unsigned(rhs), 0, rhs < 0};
-    detail::decimal128_t_components q_components {};
-
-    detail::d128_generic_div_impl(lhs_components, rhs_components, q_components);
-
-    return decimal128_t(q_components.sig, q_components.exp, q_components.sign);
+    return detail::d128_div_integer_impl<decimal128_t>(lhs_components, detail::make_positive_unsigned(rhs), sign);
 }
 
 template <typename Integer>
@@ -1947,10 +1952,11 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const Integer lhs, const decimal128_
     switch (rhs_fp)
     {
         case FP_NAN:
-            return issignaling(rhs) ? nan_conversion(rhs) : rhs;
+            return detail::check_non_finite(rhs);
         case FP_INFINITE:
             return sign ? -zero : zero;
         case FP_ZERO:
+            detail::raise_status(status_flags::fe_dec_divbyzero);
             return sign ? -inf : inf;
         default:
             static_cast<void>(lhs);
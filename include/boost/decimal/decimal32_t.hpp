@@ -213,6 +213,9 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
+    template <typename DecimalType>
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::get_components(const DecimalType& val) noexcept -> detail::components_type<DecimalType>;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
@@ -632,7 +635,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal32_t::decimal32_t(T1 coeff, T2 exp, const de
     // Only count the number of digits if we absolutely have to
     int coeff_digits {-1};
     auto biased_exp {static_cast<int>(exp + detail::bias)};
-    if (coeff > detail::d32_max_significand_value || biased_exp < -(detail::precision_v<decimal32_t> - 1))
+    if (coeff > detail::d32_max_significand_value || biased_exp < 0)
     {
         coeff_digits = detail::coefficient_rounding<decimal32_t>(coeff, exp, biased_exp, is_negative, detail::num_digits(coeff));
     }
@@ -697,6 +700,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal32_t::decimal32_t(T1 coeff, T2 exp, const de
         if (biased_exp < 0 && coeff_digits == 1)
         {
             // This needs to be flushed to 0 or rounded to subnormal min
+            detail::raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
             rounding_mode current_round_mode {_boost_decimal_global_rounding_mode};
 
             #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
@@ -776,6 +780,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal32_t::decimal32_t(T1 coeff, T2 exp, const de
                 }
                 // We may have to round the value so that it fits correctly
                 // e.g. 13e-399 -> 1e-398
+                detail::raise_rounding_status(reduced_coeff, sticky, true);
                 detail::fenv_round<decimal32_t>(reduced_coeff, is_negative, sticky);
             }
 
@@ -792,6 +797,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal32_t::decimal32_t(T1 coeff, T2 exp, const de
         else
         {
             // Reset the value and make sure to preserve the sign of 0/inf
+            detail::raise_status(exp < 0 ? status_flags::fe_dec_underflow | status_flags::fe_dec_inexact :
+                                           status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
             bits_ = exp < 0 ? UINT32_C(0) : detail::d32_inf_mask;
             bits_ |= is_negative ? detail::d32_sign_mask : UINT32_C(0);
         }
@@ -1009,12 +1016,20 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(decimal32_t rhs) noexcept-> decimal3
 // NOLINTNEXTLINE: If addition is actually subtraction than change operator and vice versa
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
 {
+    // Same quantum operands in the small significand encoding are finite, and their sum is exact
+    std::uint32_t res_bits {};
+    if (detail::bid_same_quantum_add<std::uint32_t, detail::d32_not_11_significand_mask>(lhs.bits_, rhs.bits_, res_bits))
+    {
+        return from_bits(res_bits);
+    }
+
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (!isfinite(lhs) || !isfinite(rhs))
     {
         // Case from 7.2.d
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) != signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d32_nan_mask);
         }
 
@@ -1044,10 +1059,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal32_t lhs, const Integer
     }
     #endif
 
+    const auto components {lhs.to_components()};
+    if (detail::integer_sum_is_exact<decimal32_t, Integer>(components.exp))
+    {
+        return detail::add_integer_impl<decimal32_t>(components, detail::make_positive_unsigned(rhs), rhs < 0);
+    }
+
     // Make the significand type wide enough that it won't overflow during normalization
     auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
 
-    const auto components {lhs.to_components()};
     auto sig_lhs {components.sig};
     auto exp_lhs {components.exp};
     detail::expand_significand<decimal32_t>(sig_lhs, exp_lhs);
@@ -1110,12 +1130,20 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto decimal32_t::operator+=(const Decimal rhs) noe
 // NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal32_t lhs, const decimal32_t rhs) noexcept -> decimal32_t
 {
+    // Same quantum operands in the small significand encoding are finite, and their sum is exact
+    std::uint32_t res_bits {};
+    if (detail::bid_same_quantum_add<std::uint32_t, detail::d32_not_11_significand_mask>(lhs.bits_, rhs.bits_ ^ detail::d32_sign_mask, res_bits))
+    {
+        return from_bits(res_bits);
+    }
+
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (!isfinite(lhs) || !isfinite(rhs))
     {
         // Case from 7.2.d
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d32_nan_mask);
         }
         if (isinf(rhs) && !isnan(lhs))
@@ -1151,9 +1179,14 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal32_t lhs, const Integer
     }
     #endif
 
+    const auto components {lhs.to_components()};
+    if (detail::integer_sum_is_exact<decimal32_t, Integer>(components.exp))
+    {
+        return detail::add_integer_impl<decimal32_t>(components, detail::make_positive_unsigned(rhs), !(rhs < 0));
+    }
+
     auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
 
-    const auto components {lhs.to_components()};
     auto sig_lhs {components.sig};
     auto exp_lhs {components.exp};
     detail::expand_significand<decimal32_t>(sig_lhs, exp_lhs);
@@ -1186,14 +1219,20 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const Integer lhs, const decimal32_t
         return detail::check_non_finite(rhs);
     }
     #endif
-    
+
+    auto components {rhs.to_components()};
+    if (detail::integer_sum_is_exact<decimal32_t, Integer>(components.exp))
+    {
+        components.sign = !components.sign;
+        return detail::add_integer_impl<decimal32_t>(components, detail::make_positive_unsigned(lhs), lhs < 0);
+    }
+
     auto sig_lhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(lhs))};
 
     exp_type exp_lhs {0};
     detail::normalize(sig_lhs, exp_lhs);
     const auto final_sig_lhs {static_cast<decimal32_t::significand_type>(sig_lhs)};
 
-    const auto components {rhs.to_components()};
     auto sig_rhs {components.sig};
     auto exp_rhs {components.exp};
     detail::expand_significand<decimal32_t>(sig_rhs, exp_rhs);
@@ -1809,6 +1848,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal32_t lhs, const decimal
     {
         if ((isinf(lhs) && rhs == 0) || (isinf(rhs) && lhs == 0))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d32_nan_mask);
         }
         else if (isinf(lhs) && !isnan(rhs) && (signbit(lhs) != signbit(rhs)))
@@ -1842,9 +1882,6 @@ template <typename Integer>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal32_t)
 {
-    using promoted_significand_type = detail::promote_significand_t<decimal32_t, Integer>;
-    using exp_type = decimal32_t::biased_exponent_type;
-
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (!isfinite(lhs))
     {
@@ -1861,17 +1898,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal32_t lhs, const Integer
     }
     #endif
 
-    auto sig_lhs {lhs.full_significand()};
-    auto exp_lhs {lhs.biased_exponent()};
-    detail::expand_significand<decimal32_t>(sig_lhs, exp_lhs);
-
-    auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
-    exp_type exp_rhs {0};
-    detail::normalize(sig_rhs, exp_rhs);
-    const auto final_sig_rhs {static_cast<decimal32_t::significand_type>(sig_rhs)};
-
-    return detail::mul_impl<decimal32_t>(sig_lhs, exp_lhs, lhs.isneg(),
-                                       final_sig_rhs, exp_rhs, (rhs < 0));
+    return detail::mul_integer_impl<decimal32_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), rhs < 0);
 }
 
 template <typename Integer>
@@ -1920,6 +1947,11 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto div_impl(const decimal32_t lhs, const decimal3
     {
         if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
         {
+            if (issignaling(lhs) || issignaling(rhs))
+            {
+                detail::raise_status(status_flags::fe_dec_invalid);
+            }
+
             // Operations on an SNAN return a QNAN with the same payload
             decimal32_t return_nan {};
             if (lhs_fp == rhs_fp)
@@ -1957,6 +1989,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto div_impl(const decimal32_t lhs, const decimal3
             case FP_INFINITE:
                 if (rhs_fp == FP_INFINITE)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1969,6 +2002,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto div_impl(const decimal32_t lhs, const decimal3
             case FP_ZERO:
                 if (rhs_fp == FP_ZERO)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1985,6 +2019,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto div_impl(const decimal32_t lhs, const decimal3
         switch (rhs_fp)
         {
             case FP_ZERO:
+                detail::raise_status(status_flags::fe_dec_divbyzero);
                 q = inf;
                 r = zero;
                 return;
@@ -2029,23 +2064,19 @@ template <typename Integer>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal32_t lhs, Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal32_t)
 {
-    using exp_type = decimal32_t::biased_exponent_type;
-    using sig_type = decimal32_t::significand_type;
-    using integer_type = std::conditional_t<(std::numeric_limits<Integer>::digits10 > std::numeric_limits<sig_type>::digits10), detail::make_unsigned_t<Integer>, sig_type>;
+    const bool sign {lhs.isneg() != (rhs < 0)};
 
     #ifndef BOOST_DECIMAL_FAST_MATH
     // Check pre-conditions
     constexpr decimal32_t zero {0, 0};
     constexpr decimal32_t inf {boost::decimal::from_bits(boost::decimal::detail::d32_inf_mask)};
 
-    const bool sign {lhs.isneg() != (rhs < 0)};
-
     const auto lhs_fp {fpclassify(lhs)};
 
     switch (lhs_fp)
     {
         case FP_NAN:
-            return issignaling(lhs) ? nan_conversion(lhs) : lhs;
+            return detail::check_non_finite(lhs);
         case FP_INFINITE:
             return sign ? -lhs : lhs;
         case FP_ZERO:
@@ -2056,21 +2087,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal32_t lhs, Integer rhs)
 
     if (rhs == 0)
     {
+        detail::raise_status(status_flags::fe_dec_divbyzero);
         return sign ? -inf : inf;
     }
     #endif
 
-    auto sig_lhs {lhs.full_significand()};
-    auto exp_lhs {lhs.biased_exponent()};
-    detail::expand_significand<decimal32_t>(sig_lhs, exp_lhs);
-    detail::decimal32_t_components lhs_components {sig_lhs, exp_lhs, lhs.isneg()};
-
-    exp_type exp_rhs {};
-    auto unsigned_rhs {static_cast<integer_type>(detail::make_positive_unsigned(rhs))};
-    detail::normalize(unsigned_rhs, exp_rhs);
-    detail::decimal32_t_components rhs_components {static_cast<sig_type>(unsigned_rhs), exp_rhs, rhs < 0};
+    auto lhs_components {lhs.to_components()};
+    detail::expand_significand<decimal32_t>(lhs_components.sig, lhs_components.exp);
 
-    return detail::generic_div_impl<decimal32_t>(lhs_components, rhs_components);
+    return detail::div_integer_impl<decimal32_t>(lhs_components, detail::make_positive_unsigned(rhs), sign);
 }
 
 template <typename Integer>
@@ -2097,6 +2122,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(Integer lhs, const decimal32_t rhs)
         case FP_INFINITE:
             return sign ? -zero : zero;
         case FP_ZERO:
+            detail::raise_status(status_flags::fe_dec_divbyzero);
             return sign ? -inf : inf;
         default:
             static_cast<void>(lhs);
@@ -2295,7 +2321,7 @@ constexpr auto scalbnd32(const decimal32_t num, const int expval) noexcept -> de
 
 constexpr auto copysignd32(decimal32_t mag, const decimal32_t sgn) noexcept -> decimal32_t
 {
-    mag.edit_sign(sgn.isneg());
+    mag.bits_ = (mag.bits_ & ~detail::d32_sign_mask) | (sgn.bits_ & detail::d32_sign_mask);
     return mag;
 }
 
@@ -218,6 +218,9 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
+    template <typename DecimalType>
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::get_components(const DecimalType& val) noexcept -> detail::components_type<DecimalType>;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
@@ -626,7 +629,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal64_t::decimal64_t(T1 coeff, T2 exp, const de
     // If the coeff is not in range, make it so
     int coeff_digits {-1};
     auto biased_exp {static_cast<int>(exp) + detail::bias_v<decimal64_t>};
-    if (coeff > detail::d64_max_significand_value || biased_exp < -(detail::precision_v<decimal64_t> - 1))
+    if (coeff > detail::d64_max_significand_value || biased_exp < 0)
     {
         coeff_digits = detail::coefficient_rounding<decimal64_t>(coeff, exp, biased_exp, is_negative, detail::num_digits(coeff));
     }
@@ -692,6 +695,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal64_t::decimal64_t(T1 coeff, T2 exp, const de
         {
             // This needs to be flushed to 0 or rounded to subnormal min
             // e.g. 7e-399 should not become 70e-398 but 7e-400 should become 0
+            detail::raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
             rounding_mode current_round_mode {_boost_decimal_global_rounding_mode};
 
             #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
@@ -771,6 +775,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal64_t::decimal64_t(T1 coeff, T2 exp, const de
                 }
                 // We may have to round the value so that it fits correctly
                 // e.g. 13e-399 -> 1e-398
+                detail::raise_rounding_status(reduced_coeff, sticky, true);
                 detail::fenv_round<decimal64_t>(reduced_coeff, is_negative, sticky);
             }
 
@@ -795,6 +800,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal64_t::decimal64_t(T1 coeff, T2 exp, const de
             }
             else
             {
+                detail::raise_status(exp < 0 ? status_flags::fe_dec_underflow | status_flags::fe_dec_inexact :
+                                               status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
                 bits_ = exp < 0 ? UINT64_C(0) : detail::d64_inf_mask;
                 bits_ |= is_negative ? detail::d64_sign_mask : UINT64_C(0);
             }
@@ -802,6 +809,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR decimal64_t::decimal64_t(T1 coeff, T2 exp, const de
         else
         {
             // Reset the value and make sure to preserve the sign of 0/inf
+            detail::raise_status(exp < 0 ? status_flags::fe_dec_underflow | status_flags::fe_dec_inexact :
+                                           status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
             bits_ = exp < 0 ? UINT64_C(0) : detail::d64_inf_mask;
             bits_ |= is_negative ? detail::d64_sign_mask : UINT64_C(0);
         }
@@ -1551,6 +1560,11 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_div_impl(const decimal64_t lhs, const deci
     {
         if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
         {
+            if (issignaling(lhs) || issignaling(rhs))
+            {
+                detail::raise_status(status_flags::fe_dec_invalid);
+            }
+
             // Operations on an SNAN return a QNAN with the same payload
             decimal64_t return_nan {};
             if (lhs_fp == rhs_fp)
@@ -1588,6 +1602,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_div_impl(const decimal64_t lhs, const deci
             case FP_INFINITE:
                 if (rhs_fp == FP_INFINITE)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1600,6 +1615,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_div_impl(const decimal64_t lhs, const deci
             case FP_ZERO:
                 if (rhs_fp == FP_ZERO)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1616,6 +1632,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_div_impl(const decimal64_t lhs, const deci
         switch (rhs_fp)
         {
             case FP_ZERO:
+                detail::raise_status(status_flags::fe_dec_divbyzero);
                 q = sign ? -inf : inf;
                 r = zero;
                 return;
@@ -1647,11 +1664,19 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_div_impl(const decimal64_t lhs, const deci
 
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
 {
+    // Same quantum operands in the small significand encoding are finite, and their sum is exact
+    std::uint64_t res_bits {};
+    if (detail::bid_same_quantum_add<std::uint64_t, detail::d64_not_11_significand_mask>(lhs.bits_, rhs.bits_, res_bits))
+    {
+        return from_bits(res_bits);
+    }
+
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) != signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d64_nan_mask);
         }
 
@@ -1681,6 +1706,12 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const decimal64_t lhs, const Integer
     }
     #endif
 
+    const auto components {lhs.to_components()};
+    if (detail::integer_sum_is_exact<decimal64_t, Integer>(components.exp))
+    {
+        return detail::add_integer_impl<decimal64_t>(components, detail::make_positive_unsigned(rhs), rhs < 0);
+    }
+
     auto sig_lhs {lhs.full_significand()};
     auto exp_lhs {lhs.biased_exponent()};
     detail::expand_significand<decimal64_t>(sig_lhs, exp_lhs);
@@ -1706,11 +1737,19 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(const Integer lhs, const decimal64_t
 // NOLINTNEXTLINE: If subtraction is actually addition than use operator+ and vice versa
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal64_t lhs, const decimal64_t rhs) noexcept -> decimal64_t
 {
+    // Same quantum operands in the small significand encoding are finite, and their sum is exact
+    std::uint64_t res_bits {};
+    if (detail::bid_same_quantum_add<std::uint64_t, detail::d64_not_11_significand_mask>(lhs.bits_, rhs.bits_ ^ detail::d64_sign_mask, res_bits))
+    {
+        return from_bits(res_bits);
+    }
+
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs) || not_finite(rhs))
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d64_nan_mask);
         }
         if (isinf(rhs) && !isnan(lhs))
@@ -1745,6 +1784,12 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const decimal64_t lhs, const Integer
     }
     #endif
 
+    const auto components {lhs.to_components()};
+    if (detail::integer_sum_is_exact<decimal64_t, Integer>(components.exp))
+    {
+        return detail::add_integer_impl<decimal64_t>(components, detail::make_positive_unsigned(rhs), !(rhs < 0));
+    }
+
     auto sig_lhs {lhs.full_significand()};
     auto exp_lhs {lhs.biased_exponent()};
     detail::expand_significand<decimal64_t>(sig_lhs, exp_lhs);
@@ -1779,6 +1824,13 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(const Integer lhs, const decimal64_t
     }
     #endif
 
+    auto components {rhs.to_components()};
+    if (detail::integer_sum_is_exact<decimal64_t, Integer>(components.exp))
+    {
+        components.sign = !components.sign;
+        return detail::add_integer_impl<decimal64_t>(components, detail::make_positive_unsigned(lhs), lhs < 0);
+    }
+
     auto sig_lhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(lhs))};
     exp_type exp_lhs {0};
     detail::normalize<decimal64_t>(sig_lhs, exp_lhs);
@@ -1801,6 +1853,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal64_t lhs, const decimal
     {
         if ((isinf(lhs) && rhs == 0) || (isinf(rhs) && lhs == 0))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return from_bits(detail::d64_nan_mask);
         }
         else if (isinf(lhs) && !isnan(rhs) && (signbit(lhs) != signbit(rhs)))
@@ -1834,9 +1887,6 @@ template <typename Integer>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal64_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal64_t)
 {
-    using promoted_significand_type = detail::promote_significand_t<decimal64_t, Integer>;
-    using exp_type = decimal64_t::biased_exponent_type;
-
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs))
     {
@@ -1853,17 +1903,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const decimal64_t lhs, const Integer
     }
     #endif
 
-    auto lhs_sig {lhs.full_significand()};
-    auto lhs_exp {lhs.biased_exponent()};
-    detail::expand_significand<decimal64_t>(lhs_sig, lhs_exp);
-
-    auto rhs_sig {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
-    exp_type rhs_exp {0};
-    detail::normalize<decimal64_t>(rhs_sig, rhs_exp);
-    const auto final_rhs_sig {static_cast<decimal64_t::significand_type>(rhs_sig)};
-
-    return detail::d64_mul_impl<decimal64_t>(lhs_sig, lhs_exp, lhs.isneg(),
-                                           final_rhs_sig, rhs_exp, (rhs < 0));
+    return detail::mul_integer_impl<decimal64_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), rhs < 0);
 }
 
 template <typename Integer>
@@ -1886,10 +1926,6 @@ template <typename Integer>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal64_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal64_t)
 {
-    using sig_type = decimal64_t::significand_type;
-    using exp_type = decimal64_t::biased_exponent_type;
-    using integer_type = std::conditional_t<(std::numeric_limits<Integer>::digits10 > std::numeric_limits<sig_type>::digits10), detail::make_unsigned_t<Integer>, sig_type>;
-
     const bool sign {lhs.isneg() != (rhs < 0)};
 
     #ifndef BOOST_DECIMAL_FAST_MATH
@@ -1902,7 +1938,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal64_t lhs, const Integer
     switch (lhs_fp)
     {
         case FP_NAN:
-            return issignaling(lhs) ? nan_conversion(lhs) : lhs;
+            return detail::check_non_finite(lhs);
         case FP_INFINITE:
             return sign ? -lhs : lhs;
         case FP_ZERO:
@@ -1913,21 +1949,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const decimal64_t lhs, const Integer
 
     if (rhs == 0)
     {
+        detail::raise_status(status_flags::fe_dec_divbyzero);
         return sign ? -inf : inf;
     }
     #endif
 
-    auto lhs_sig {lhs.full_significand()};
-    auto lhs_exp {lhs.biased_exponent()};
-    detail::expand_significand<decimal64_t>(lhs_sig, lhs_exp);
-    detail::decimal64_t_components lhs_components {lhs_sig, lhs_exp, lhs.isneg()};
-
-    auto rhs_sig {static_cast<integer_type>(detail::make_positive_unsigned(rhs))};
-    exp_type rhs_exp {};
-    detail::normalize<decimal64_t>(rhs_sig, rhs_exp);
-    detail::decimal64_t_components rhs_components {static_cast<sig_type>(rhs_sig), rhs_exp, rhs < 0};
+    auto lhs_components {lhs.to_components()};
+    detail::expand_significand<decimal64_t>(lhs_components.sig, lhs_components.exp);
 
-    return detail::d64_generic_div_impl<decimal64_t>(lhs_components, rhs_components, sign);
+    return detail::div_integer_impl<decimal64_t>(lhs_components, detail::make_positive_unsigned(rhs), sign);
 }
 
 template <typename Integer>
@@ -1950,10 +1980,11 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const Integer lhs, const decimal64_t
     switch (rhs_fp)
     {
         case FP_NAN:
-            return issignaling(rhs) ? nan_conversion(rhs) : rhs;
+            return detail::check_non_finite(rhs);
         case FP_INFINITE:
             return sign ? -zero : zero;
         case FP_ZERO:
+            detail::raise_status(status_flags::fe_dec_divbyzero);
             return sign ? -inf : inf;
         default:
             static_cast<void>(lhs);
@@ -2203,7 +2234,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto scalbnd64(const decimal64_t num, const int exp
 
 BOOST_DECIMAL_CUDA_CONSTEXPR auto copysignd64(decimal64_t mag, const decimal64_t sgn) noexcept -> decimal64_t
 {
-    mag.edit_sign(sgn.isneg());
+    mag.bits_ = (mag.bits_ & ~detail::d64_sign_mask) | (sgn.bits_ & detail::d64_sign_mask);
     return mag;
 }
 
@@ -0,0 +1,771 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECIMAL_ACCUMULATOR_HPP
+#define BOOST_DECIMAL_DECIMAL_ACCUMULATOR_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/cfenv.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/check_non_finite.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include <boost/decimal/detail/i256.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+#include <iterator>
+#include <span>
+#endif
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The partial sums are kept below 2^252 so that adding a term, which is below 10^75 < 2^252, can never overflow.
+// The most significant word of a partial sum that has reached that bound
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE std::uint64_t accumulator_overflow_word {UINT64_C(1) << 60U};
+
+// The largest number of digits of a term or of a partial sum that is being rescaled
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE int accumulator_max_digits {75};
+
+// Returns sig * 10^shift where the result has no more than accumulator_max_digits digits
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_term(const std::uint64_t sig, const int shift) noexcept -> u256
+{
+    if (shift <= 19)
+    {
+        return u256{int128::uint128_t{sig} * pow10(static_cast<std::uint64_t>(shift))};
+    }
+    else if (shift <= 38)
+    {
+        return mul128By64(pow10(static_cast<int128::uint128_t>(shift)), sig);
+    }
+
+    return pow10_256(static_cast<std::size_t>(shift)) * sig;
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_term(const std::uint32_t sig, const int shift) noexcept -> u256
+{
+    return accumulator_term(static_cast<std::uint64_t>(sig), shift);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_term(const int128::uint128_t& sig, const int shift) noexcept -> u256
+{
+    if (shift <= 19)
+    {
+        return mul128By64(sig, pow10(static_cast<std::uint64_t>(shift)));
+    }
+    else if (shift <= 38)
+    {
+        return umul256(sig, pow10(static_cast<int128::uint128_t>(shift)));
+    }
+
+    return pow10_256(static_cast<std::size_t>(shift)) * u256{sig};
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_term(const u256& sig, const int shift) noexcept -> u256
+{
+    return shift == 0 ? sig : sig * pow10_256(static_cast<std::size_t>(shift));
+}
+
+// The exact product of two significands, which has at most twice the digits of the operands
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_product(const std::uint32_t lhs, const std::uint32_t rhs) noexcept -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(lhs) * rhs;
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_product(const std::uint64_t lhs, const std::uint64_t rhs) noexcept -> int128::uint128_t
+{
+    return int128::uint128_t{lhs} * rhs;
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_product(const int128::uint128_t& lhs, const int128::uint128_t& rhs) noexcept -> u256
+{
+    return umul256(lhs, rhs);
+}
+
+// Divides x by 10^shift truncating towards zero, and returns the digits that were removed
+BOOST_DECIMAL_FORCE_INLINE constexpr auto accumulator_truncate(u256& x, const int shift) noexcept -> u256
+{
+    if (shift <= 0 || x == 0U)
+    {
+        return u256{};
+    }
+
+    if (shift > std::numeric_limits<u256>::digits10 || x < pow10_256(static_cast<std::size_t>(shift)))
+    {
+        const auto removed {x};
+        x = u256{};
+        return removed;
+    }
+
+    const auto res {impl::div_mod(x, pow10_256(static_cast<std::size_t>(shift)))};
+    x = res.quotient;
+
+    return res.remainder;
+}
+
+// The digits that the 75-digit window of decimal_accumulator drops, which only happens when the values
+// span more digits than that. They are kept exactly as limbs of 18 digits, each in (-10^18, 10^18),
+// that cover every exponent of a product of two values of DecimalType.
+template <typename DecimalType>
+class accumulator_remainder
+{
+    static constexpr int limb_digits {18};
+    static constexpr std::int64_t limb_base {INT64_C(1000000000000000000)};
+
+    // The lowest digit of a product of two subnormals, and the highest digit of a sum of up to 10^20 of the largest products
+    static constexpr int min_exp {2 * (etiny_v<DecimalType> - precision_v<DecimalType>)};
+    static constexpr int max_exp {2 * (emax_v<DecimalType> + 1) + 20};
+    static constexpr std::size_t size {static_cast<std::size_t>((max_exp - min_exp) / limb_digits + 2)};
+
+    std::array<std::int64_t, size> limbs_ {};
+
+    // Adds value to limb i, carrying into the limbs above it
+    auto add_limb(std::size_t i, std::int64_t value) noexcept -> void
+    {
+        while (value != 0)
+        {
+            BOOST_DECIMAL_ASSERT(i < size);
+
+            auto limb {limbs_[i] + value};
+            value = 0;
+            if (limb >= limb_base)
+            {
+                limb -= limb_base;
+                value = 1;
+            }
+            else if (limb <= -limb_base)
+            {
+                limb += limb_base;
+                value = -1;
+            }
+
+            limbs_[i++] = limb;
+        }
+    }
+
+public:
+    // Adds x * 10^exp with the given sign
+    auto add(u256 x, const int exp, const bool sign) noexcept -> void
+    {
+        if (x == 0U)
+        {
+            return;
+        }
+
+        BOOST_DECIMAL_ASSERT(exp >= min_exp);
+
+        auto i {static_cast<std::size_t>((exp - min_exp) / limb_digits)};
+        const auto offset {(exp - min_exp) % limb_digits};
+
+        // The lowest limb only takes the digits below the next multiple of 18
+        auto digits {limb_digits - offset};
+        while (x != 0U)
+        {
+            const auto res {impl::div_mod(x, pow10(static_cast<std::uint64_t>(digits)))};
+            auto limb {static_cast<std::int64_t>(res.remainder[0])};
+            if (digits != limb_digits)
+            {
+                limb *= static_cast<std::int64_t>(pow10(static_cast<std::uint64_t>(offset)));
+            }
+
+            add_limb(i++, sign ? -limb : limb);
+            x = res.quotient;
+            digits = limb_digits;
+        }
+    }
+
+    auto merge(const accumulator_remainder& other) noexcept -> void
+    {
+        for (std::size_t i {}; i < size; ++i)
+        {
+            add_limb(i, other.limbs_[i]);
+        }
+    }
+
+    // Returns a significand and exponent that round the same way as the exact value to any precision of up to 54 digits.
+    // The significand is the leading 55 to 72 digits, with one more digit of 1 or 9 when any non-zero digits follow them.
+    auto leading_digits(int& exp, bool& sign) const noexcept -> u256
+    {
+        auto top {size};
+        while (top > 0U && limbs_[top - 1U] == 0)
+        {
+            --top;
+        }
+
+        if (top == 0U)
+        {
+            exp = 0;
+            sign = false;
+            return u256{};
+        }
+
+        // The sign of the value is the sign of its leading limb, since the limbs below it add up to less than one unit of it
+        --top;
+        sign = limbs_[top] < 0;
+        const auto low {top >= 3U ? top - 3U : std::size_t{0}};
+
+        u256 sig {};
+        for (auto i {top + 1U}; i-- > low;)
+        {
+            sig = sig * u256{static_cast<std::uint64_t>(limb_base)};
+            const auto limb {sign ? -limbs_[i] : limbs_[i]};
+            sig = limb >= 0 ? sig + u256{static_cast<std::uint64_t>(limb)} : sig - u256{static_cast<std::uint64_t>(-limb)};
+        }
+
+        auto below {low};
+        while (below > 0U && limbs_[below - 1U] == 0)
+        {
+            --below;
+        }
+
+        sig = sig * u256{UINT64_C(10)};
+        if (below > 0U)
+        {
+            // The digits below lie within one unit of the leading digits, either away from zero or towards it
+            sig = (limbs_[below - 1U] < 0) == sign ? sig + u256{UINT64_C(1)} : sig - u256{UINT64_C(1)};
+        }
+
+        exp = min_exp + static_cast<int>(low) * limb_digits - 1;
+
+        return sig;
+    }
+};
+
+// Rounds the exact sum once to DecimalType
+template <typename DecimalType, std::enable_if_t<(sizeof(typename DecimalType::significand_type) >= sizeof(std::uint64_t)), bool> = true>
+auto accumulator_result(const u256& sig, const int exp, const bool sign) noexcept -> DecimalType
+{
+    return DecimalType{sig, exp, sign};
+}
+
+// The 32-bit types are constructed from a 64-bit coefficient.
+// Truncating to 19 digits keeps at least two digits below the precision, so making the quotient odd
+// when digits are removed keeps the information that the value is inexact through the final rounding.
+template <typename DecimalType, std::enable_if_t<(sizeof(typename DecimalType::significand_type) < sizeof(std::uint64_t)), bool> = true>
+auto accumulator_result(u256 sig, int exp, const bool sign) noexcept -> DecimalType
+{
+    const auto digits {num_digits(sig)};
+    if (digits > std::numeric_limits<std::uint64_t>::digits10)
+    {
+        const auto shift {digits - std::numeric_limits<std::uint64_t>::digits10};
+        if (accumulator_truncate(sig, shift) != 0U)
+        {
+            sig[0] |= UINT64_C(1);
+        }
+        exp += shift;
+    }
+
+    return DecimalType{static_cast<std::uint64_t>(sig), exp, sign};
+}
+
+} // namespace detail
+
+// Sums a sequence of values without rounding each partial sum.
+//
+// The sum is kept as a 256-bit integer significand of each sign along with a running exponent,
+// so adding a value costs an integer multiplication by a power of ten (when its exponent
+// differs from the running exponent) and an integer addition.
+// Digits that fall out of the 75 digits of the running sum are kept in a detail::accumulator_remainder.
+// The exact sum is rounded once, in the current rounding mode, by result().
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class decimal_accumulator
+{
+    static_assert(detail::is_decimal_floating_point_v<DecimalType>, "decimal_accumulator requires a decimal floating point type");
+
+public:
+    using value_type = DecimalType;
+
+private:
+    // The running sum is (positive_ - negative_) * 10^exp_, and the exact sum adds dropped_ to it if has_dropped_
+    detail::u256 positive_ {};
+    detail::u256 negative_ {};
+    bool has_dropped_ {};
+    int exp_ {(std::numeric_limits<int>::max)()};
+    detail::accumulator_remainder<DecimalType> dropped_ {};
+
+    // Bit 0 is set once a finite positive value has been added, and bit 1 for a finite negative value
+    unsigned signs_ {};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    DecimalType nan_ {};
+    bool has_nan_ {};
+    bool has_positive_inf_ {};
+    bool has_negative_inf_ {};
+    #endif
+
+    // Adds a term with at most max_digits digits
+    template <int max_digits, typename Significand>
+    auto add_finite(const Significand& sig, int exp, bool sign) noexcept -> void;
+
+    auto add_finite_product(DecimalType x, DecimalType y) noexcept -> void;
+    auto add_non_finite(DecimalType x) noexcept -> void;
+
+    // Keeps the digits of sig * 10^exp that are dropped from the running sum
+    auto add_dropped(const detail::u256& sig, int exp, bool sign) noexcept -> void;
+
+    // Raises the running exponent by shift, moving the digits below it to dropped_
+    auto scale_down(int shift) noexcept -> void;
+
+    // Lowers the running exponent towards exp as far as the running sum allows without overflow
+    auto scale_up(int exp) noexcept -> void;
+
+public:
+    decimal_accumulator() noexcept = default;
+
+    auto operator+=(DecimalType x) noexcept -> decimal_accumulator&;
+    auto operator-=(DecimalType x) noexcept -> decimal_accumulator& { return *this += -x; }
+
+    // Adds values[i] for i in [0, n)
+    auto accumulate(const DecimalType* values, std::size_t n) noexcept -> decimal_accumulator&;
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    auto accumulate(std::span<const DecimalType> values) noexcept -> decimal_accumulator& { return accumulate(values.data(), values.size()); }
+
+    #endif
+
+    // Adds the exact product x * y
+    auto add_product(DecimalType x, DecimalType y) noexcept -> decimal_accumulator&;
+
+    // Adds the exact products a[i] * b[i] for i in [0, n)
+    auto accumulate_products(const DecimalType* a, const DecimalType* b, std::size_t n) noexcept -> decimal_accumulator&;
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    // The sizes must be equal, as asserted in debug builds.
+    // If they are not, only the smaller of them is processed, so that no span is accessed past its end.
+    auto accumulate_products(std::span<const DecimalType> a, std::span<const DecimalType> b) noexcept -> decimal_accumulator&;
+
+    #endif
+
+    // Adds the values summed by other, e.g. the partial sum of another thread
+    auto merge(const decimal_accumulator& other) noexcept -> decimal_accumulator&;
+
+    // Returns the sum rounded once in the current rounding mode.
+    // The sum of no values is +0.
+    auto result() const noexcept -> DecimalType;
+
+    auto clear() noexcept -> void { *this = decimal_accumulator{}; }
+};
+
+template <typename DecimalType>
+BOOST_DECIMAL_NO_INLINE auto decimal_accumulator<DecimalType>::add_dropped(const detail::u256& sig, const int exp, const bool sign) noexcept -> void
+{
+    if (sig != detail::u256{})
+    {
+        dropped_.add(sig, exp, sign);
+        has_dropped_ = true;
+    }
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::scale_down(const int shift) noexcept -> void
+{
+    // The signs are combined first, so that the digits removed from the two sums can not cancel
+    detail::u256 sum {};
+    const auto is_negative {detail::i256_sub(positive_, negative_, sum)};
+    add_dropped(detail::accumulator_truncate(sum, shift), exp_, is_negative);
+
+    positive_ = is_negative ? detail::u256{} : sum;
+    negative_ = is_negative ? sum : detail::u256{};
+    exp_ += shift;
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::scale_up(const int exp) noexcept -> void
+{
+    BOOST_DECIMAL_ASSERT(exp < exp_);
+
+    const auto& larger {positive_ > negative_ ? positive_ : negative_};
+    if (larger == detail::u256{})
+    {
+        exp_ = exp;
+        return;
+    }
+
+    // Values of at least 2^248 already have 75 digits, so there is no room to scale them
+    if (larger[3] >= (UINT64_C(1) << 56U))
+    {
+        return;
+    }
+
+    const auto room {detail::accumulator_max_digits - detail::num_digits(larger)};
+    const auto shift {exp_ - exp < room ? exp_ - exp : room};
+
+    if (shift > 0)
+    {
+        const auto scale {detail::pow10_256(static_cast<std::size_t>(shift))};
+        positive_ = positive_ * scale;
+        negative_ = negative_ * scale;
+        exp_ -= shift;
+    }
+}
+
+template <typename DecimalType>
+template <int max_digits, typename Significand>
+BOOST_DECIMAL_FORCE_INLINE auto decimal_accumulator<DecimalType>::add_finite(const Significand& sig, const int exp, const bool sign) noexcept -> void
+{
+    // The largest exponent difference for which any term is exact
+    constexpr int max_shift {detail::accumulator_max_digits - max_digits};
+
+    signs_ |= 1U << static_cast<unsigned>(sign);
+
+    if (BOOST_DECIMAL_UNLIKELY(exp < exp_))
+    {
+        scale_up(exp);
+    }
+
+    auto shift {exp - exp_};
+    if (BOOST_DECIMAL_UNLIKELY(shift > max_shift))
+    {
+        // The value is so much larger than the running sum that the low digits of the sum are dropped
+        const auto limit {detail::accumulator_max_digits - detail::num_digits(sig)};
+        if (shift > limit)
+        {
+            scale_down(shift - limit);
+            shift = limit;
+        }
+    }
+
+    detail::u256 term {};
+    if (BOOST_DECIMAL_LIKELY(shift >= 0))
+    {
+        term = detail::accumulator_term(sig, shift);
+    }
+    else
+    {
+        // The running sum had no room to reach the exponent of the value
+        term = detail::accumulator_term(sig, 0);
+        add_dropped(detail::accumulator_truncate(term, -shift), exp, sign);
+    }
+
+    auto& sum {sign ? negative_ : positive_};
+    sum = sum + term;
+
+    if (BOOST_DECIMAL_UNLIKELY(sum[3] >= detail::accumulator_overflow_word))
+    {
+        scale_down(1);
+    }
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::add_non_finite(const DecimalType x) noexcept -> void
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (isnan(x))
+    {
+        if (!has_nan_)
+        {
+            nan_ = x;
+            has_nan_ = true;
+        }
+    }
+    else if (signbit(x))
+    {
+        has_negative_inf_ = true;
+    }
+    else
+    {
+        has_positive_inf_ = true;
+    }
+    #else
+    static_cast<void>(x);
+    #endif
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::operator+=(const DecimalType x) noexcept -> decimal_accumulator&
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(x))
+    {
+        add_non_finite(x);
+        return *this;
+    }
+    #endif
+
+    const auto components {detail::get_components(x)};
+    add_finite<detail::precision_v<DecimalType>>(components.sig, static_cast<int>(components.exp), components.sign);
+
+    return *this;
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::accumulate(const DecimalType* values, const std::size_t n) noexcept -> decimal_accumulator&
+{
+    std::size_t i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(detail::batch_has_non_finite(values + i, block)))
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                *this += values[j];
+            }
+        }
+        else
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                const auto components {detail::get_components(values[j])};
+                add_finite<detail::precision_v<DecimalType>>(components.sig, static_cast<int>(components.exp), components.sign);
+            }
+        }
+
+        i += block;
+    }
+
+    return *this;
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE auto decimal_accumulator<DecimalType>::add_finite_product(const DecimalType x, const DecimalType y) noexcept -> void
+{
+    const auto x_components {detail::get_components(x)};
+    const auto y_components {detail::get_components(y)};
+
+    add_finite<2 * detail::precision_v<DecimalType>>(detail::accumulator_product(x_components.sig, y_components.sig),
+                                                      static_cast<int>(x_components.exp) + static_cast<int>(y_components.exp),
+                                                      x_components.sign != y_components.sign);
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::add_product(const DecimalType x, const DecimalType y) noexcept -> decimal_accumulator&
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(x) || !isfinite(y))
+    {
+        add_non_finite(x * y);
+        return *this;
+    }
+    #endif
+
+    add_finite_product(x, y);
+
+    return *this;
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::accumulate_products(const DecimalType* a, const DecimalType* b, const std::size_t n) noexcept -> decimal_accumulator&
+{
+    std::size_t i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(detail::batch_has_non_finite(a + i, block) || detail::batch_has_non_finite(b + i, block)))
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                add_product(a[j], b[j]);
+            }
+        }
+        else
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                add_finite_product(a[j], b[j]);
+            }
+        }
+
+        i += block;
+    }
+
+    return *this;
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::accumulate_products(std::span<const DecimalType> a, std::span<const DecimalType> b) noexcept -> decimal_accumulator&
+{
+    BOOST_DECIMAL_ASSERT(a.size() == b.size());
+    return accumulate_products(a.data(), b.data(), a.size() < b.size() ? a.size() : b.size());
+}
+
+#endif
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::merge(const decimal_accumulator& other) noexcept -> decimal_accumulator&
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (other.has_nan_)
+    {
+        add_non_finite(other.nan_);
+    }
+    has_positive_inf_ = has_positive_inf_ || other.has_positive_inf_;
+    has_negative_inf_ = has_negative_inf_ || other.has_negative_inf_;
+    #endif
+
+    if (other.signs_ == 0U)
+    {
+        return *this;
+    }
+
+    signs_ |= other.signs_;
+
+    // Bring both running sums to a common exponent, which is the smaller of the two unless that would overflow
+    auto rhs {other};
+    if (rhs.exp_ < exp_)
+    {
+        scale_up(rhs.exp_);
+    }
+    else if (exp_ < rhs.exp_)
+    {
+        rhs.scale_up(exp_);
+    }
+
+    if (exp_ < rhs.exp_)
+    {
+        scale_down(rhs.exp_ - exp_);
+    }
+    else if (rhs.exp_ < exp_)
+    {
+        rhs.scale_down(exp_ - rhs.exp_);
+    }
+
+    positive_ = positive_ + rhs.positive_;
+    negative_ = negative_ + rhs.negative_;
+    if (rhs.has_dropped_)
+    {
+        dropped_.merge(rhs.dropped_);
+        has_dropped_ = true;
+    }
+
+    if (positive_[3] >= detail::accumulator_overflow_word || negative_[3] >= detail::accumulator_overflow_word)
+    {
+        scale_down(1);
+    }
+
+    return *this;
+}
+
+template <typename DecimalType>
+auto decimal_accumulator<DecimalType>::result() const noexcept -> DecimalType
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (has_nan_)
+    {
+        return detail::check_non_finite(nan_);
+    }
+    if (has_positive_inf_ && has_negative_inf_)
+    {
+        return std::numeric_limits<DecimalType>::quiet_NaN();
+    }
+    if (has_positive_inf_ || has_negative_inf_)
+    {
+        return has_positive_inf_ ? std::numeric_limits<DecimalType>::infinity() : -std::numeric_limits<DecimalType>::infinity();
+    }
+    #endif
+
+    if (signs_ == 0U)
+    {
+        return DecimalType{0};
+    }
+
+    detail::u256 sig {};
+    auto is_negative {detail::i256_sub(positive_, negative_, sig)};
+    auto exp {exp_};
+
+    if (has_dropped_)
+    {
+        auto total {dropped_};
+        total.add(sig, exp_, is_negative);
+        sig = total.leading_digits(exp, is_negative);
+    }
+
+    if (sig == detail::u256{})
+    {
+        // IEEE 754 6.3: An exact zero sum of operands with opposite signs is +0,
+        // except when rounding towards negative infinity in which case it is -0.
+        // The sum of only -0s is -0.
+        is_negative = signs_ == 2U || (signs_ == 3U && fegetround() == rounding_mode::fe_dec_downward);
+    }
+
+    return detail::accumulator_result<DecimalType>(sig, exp, is_negative);
+}
+
+// Returns the sum of a[i] * b[i] for i in [0, n), rounded once
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto dot(const DecimalType* a, const DecimalType* b, const std::size_t n) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc.accumulate_products(a, b, n);
+    return acc.result();
+}
+
+// Returns init plus the sum of a[i] * b[i] for i in [0, n), rounded once
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto fma_reduce(const DecimalType* a, const DecimalType* b, const std::size_t n, const DecimalType init) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc += init;
+    acc.accumulate_products(a, b, n);
+    return acc.result();
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+namespace detail {
+
+// The element type of a contiguous range, such as std::vector<T>, std::array<T, N> or std::span<T>
+template <typename Range>
+using contiguous_range_value_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::data(std::declval<const Range&>()))>>;
+
+} // namespace detail
+
+// a and b are contiguous ranges of DecimalType, such as std::vector<DecimalType> or std::span<DecimalType>,
+// and DecimalType is deduced from a.
+// The sizes must be equal, as asserted in debug builds.
+// If they are not, only the smaller of them is processed, so that no range is accessed past its end.
+BOOST_DECIMAL_EXPORT template <typename RangeA, typename RangeB, typename DecimalType = detail::contiguous_range_value_t<RangeA>>
+auto dot(const RangeA& a, const RangeB& b) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc.accumulate_products(std::span<const DecimalType>(a), std::span<const DecimalType>(b));
+    return acc.result();
+}
+
+BOOST_DECIMAL_EXPORT template <typename RangeA, typename RangeB, typename DecimalType = detail::contiguous_range_value_t<RangeA>>
+auto fma_reduce(const RangeA& a, const RangeB& b, const detail::type_identity_t<DecimalType> init) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc += init;
+    acc.accumulate_products(std::span<const DecimalType>(a), std::span<const DecimalType>(b));
+    return acc.result();
+}
+
+#endif
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECIMAL_ACCUMULATOR_HPP
@@ -0,0 +1,735 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECIMAL_COLUMN_HPP
+#define BOOST_DECIMAL_DECIMAL_COLUMN_HPP
+
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+#include <span>
+#endif
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Allocates the lanes of a column on an alignment boundary (e.g. a cache line)
+template <typename T, std::size_t Alignment>
+class column_allocator
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = column_allocator<U, Alignment>;
+    };
+
+    column_allocator() noexcept = default;
+
+    template <typename U>
+    column_allocator(const column_allocator<U, Alignment>&) noexcept {}
+
+    auto allocate(const std::size_t n) -> T*
+    {
+        #if defined(__cpp_aligned_new) && __cpp_aligned_new >= 201606L
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+        #else
+        // Over-allocate and keep the pointer to the start of the block just before the aligned storage
+        void* block {std::malloc(n * sizeof(T) + Alignment + sizeof(void*))};
+        if (block == nullptr)
+        {
+            BOOST_DECIMAL_THROW_EXCEPTION(std::bad_alloc());
+
+            // Without exceptions there is no way to report the failure, just as with operator new
+            std::abort(); // LCOV_EXCL_LINE
+        }
+
+        const auto address {reinterpret_cast<std::uintptr_t>(block) + sizeof(void*)};
+        auto* aligned {reinterpret_cast<void**>((address + Alignment - 1U) & ~(Alignment - 1U))};
+        aligned[-1] = block;
+
+        return reinterpret_cast<T*>(aligned);
+        #endif
+    }
+
+    auto deallocate(T* p, std::size_t) noexcept -> void
+    {
+        #if defined(__cpp_aligned_new) && __cpp_aligned_new >= 201606L
+        ::operator delete(p, std::align_val_t{Alignment});
+        #else
+        std::free(reinterpret_cast<void**>(p)[-1]);
+        #endif
+    }
+
+    template <typename U>
+    constexpr auto operator==(const column_allocator<U, Alignment>&) const noexcept -> bool { return true; }
+
+    template <typename U>
+    constexpr auto operator!=(const column_allocator<U, Alignment>&) const noexcept -> bool { return false; }
+};
+
+template <typename DecimalType>
+constexpr auto column_make(const typename DecimalType::significand_type sig, const typename DecimalType::exponent_type exp, const bool sign) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast32_t>::value, DecimalType>
+{
+    return direct_init(sig, exp, sign);
+}
+
+template <typename DecimalType>
+constexpr auto column_make(const typename DecimalType::significand_type sig, const typename DecimalType::exponent_type exp, const bool sign) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast64_t>::value, DecimalType>
+{
+    return direct_init_d64(sig, exp, sign);
+}
+
+template <typename DecimalType>
+constexpr auto column_make(const typename DecimalType::significand_type sig, const typename DecimalType::exponent_type exp, const bool sign) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast128_t>::value, DecimalType>
+{
+    return direct_init_d128(sig, exp, sign);
+}
+
+template <typename DecimalType>
+using column_key_type = std::conditional_t<std::is_same<DecimalType, decimal_fast128_t>::value, int128::uint128_t, std::uint64_t>;
+
+// Maps the fields of a finite value to an unsigned integer that orders the same way as operator<.
+// The significands of the fast types are normalized, so for non-zero values the exponent can be
+// placed directly above the significand. Negative values are mirrored below the midpoint.
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_key(const typename DecimalType::significand_type sig,
+                                                     const typename DecimalType::exponent_type exp,
+                                                     const bool sign) noexcept -> column_key_type<DecimalType>
+{
+    using key_type = column_key_type<DecimalType>;
+
+    constexpr key_type half {key_type{1U} << (std::numeric_limits<key_type>::digits - 1)};
+    constexpr key_type ten_pow_precision {pow10(static_cast<key_type>(precision_v<DecimalType>))};
+
+    const key_type magnitude {sig == 0U ? key_type{0U} : static_cast<key_type>(exp) * ten_pow_precision + sig};
+
+    #ifdef BOOST_DECIMAL_FAST_MATH
+    // Without signed zeros both compare the same
+    if (magnitude == 0U)
+    {
+        return half;
+    }
+    #endif
+
+    // operator< orders -0 below +0, which this keeps
+    return sign ? static_cast<key_type>(half - 1U - magnitude) : static_cast<key_type>(half + magnitude);
+}
+
+// Zeros of either sign have the two keys on each side of the midpoint
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_key_equal(const column_key_type<DecimalType> lhs, const column_key_type<DecimalType> rhs) noexcept -> bool
+{
+    using key_type = column_key_type<DecimalType>;
+
+    constexpr key_type below_half {(key_type{1U} << (std::numeric_limits<key_type>::digits - 1)) - 1U};
+
+    return lhs == rhs || (static_cast<key_type>(lhs - below_half) <= 1U && static_cast<key_type>(rhs - below_half) <= 1U);
+}
+
+// The finite paths of operator+ and operator* for each type
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_add(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+{
+    return add_impl<decimal_fast32_t>(lhs, rhs);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_add(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+{
+    return add_impl<decimal_fast64_t>(lhs, rhs);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_add(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
+{
+    return d128_add_impl_new<decimal_fast128_t>(lhs, rhs);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_mul(const decimal_fast32_t lhs, const decimal_fast32_t rhs) noexcept -> decimal_fast32_t
+{
+    return mul_impl<decimal_fast32_t>(lhs, rhs);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_mul(const decimal_fast64_t lhs, const decimal_fast64_t rhs) noexcept -> decimal_fast64_t
+{
+    return d64_mul_impl<decimal_fast64_t>(lhs, rhs);
+}
+
+BOOST_DECIMAL_FORCE_INLINE constexpr auto column_mul(const decimal_fast128_t& lhs, const decimal_fast128_t& rhs) noexcept -> decimal_fast128_t
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    return d128_mul_impl<decimal_fast128_t>(x.sig, x.exp, x.sign, y.sig, y.exp, y.sign);
+}
+
+// Each operation pairs the scalar operator (used when a non-finite value is involved) with its finite path
+struct column_plus
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> T { return lhs + rhs; }
+
+    template <typename T>
+    static constexpr auto finite(const T& lhs, const T& rhs) noexcept -> T { return column_add(lhs, rhs); }
+};
+
+struct column_minus
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> T { return lhs - rhs; }
+
+    template <typename T>
+    static constexpr auto finite(const T& lhs, const T& rhs) noexcept -> T { return column_add(lhs, -rhs); }
+};
+
+struct column_multiplies
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> T { return lhs * rhs; }
+
+    template <typename T>
+    static constexpr auto finite(const T& lhs, const T& rhs) noexcept -> T { return column_mul(lhs, rhs); }
+};
+
+// Comparisons on values and on keys
+struct column_less
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> bool { return lhs < rhs; }
+
+    template <typename DecimalType, typename Key>
+    static constexpr auto key(const Key lhs, const Key rhs) noexcept -> bool { return lhs < rhs; }
+};
+
+struct column_less_equal
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> bool { return lhs <= rhs; }
+
+    template <typename DecimalType, typename Key>
+    static constexpr auto key(const Key lhs, const Key rhs) noexcept -> bool { return lhs <= rhs; }
+};
+
+struct column_greater
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> bool { return lhs > rhs; }
+
+    template <typename DecimalType, typename Key>
+    static constexpr auto key(const Key lhs, const Key rhs) noexcept -> bool { return lhs > rhs; }
+};
+
+struct column_greater_equal
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> bool { return lhs >= rhs; }
+
+    template <typename DecimalType, typename Key>
+    static constexpr auto key(const Key lhs, const Key rhs) noexcept -> bool { return lhs >= rhs; }
+};
+
+struct column_equal
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> bool { return lhs == rhs; }
+
+    template <typename DecimalType, typename Key>
+    static constexpr auto key(const Key lhs, const Key rhs) noexcept -> bool { return column_key_equal<DecimalType>(lhs, rhs); }
+};
+
+struct column_not_equal
+{
+    template <typename T>
+    static constexpr auto scalar(const T& lhs, const T& rhs) noexcept -> bool { return lhs != rhs; }
+
+    template <typename DecimalType, typename Key>
+    static constexpr auto key(const Key lhs, const Key rhs) noexcept -> bool { return !column_key_equal<DecimalType>(lhs, rhs); }
+};
+
+} // namespace detail
+
+// A column of decimal values stored as a structure of arrays.
+// The significand, exponent and sign of each value are kept in separate aligned arrays (lanes),
+// so scans only touch the bytes they need and the loops over them can be vectorized.
+// Only the fast types are supported since they already store their fields unpacked.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class decimal_column
+{
+    static_assert(detail::is_decimal_floating_point_v<DecimalType> && detail::is_fast_type_v<DecimalType>,
+                  "decimal_column requires one of the fast decimal types");
+
+public:
+    using value_type = DecimalType;
+    using size_type = std::size_t;
+    using significand_type = typename DecimalType::significand_type;
+    using exponent_type = typename DecimalType::exponent_type;
+    using sign_type = std::uint8_t;
+
+    // Alignment of each lane in bytes
+    static constexpr std::size_t alignment {64U};
+
+    // Proxy to an element, which reads and writes the value across the lanes
+    class reference
+    {
+        decimal_column* column_;
+        size_type index_;
+
+        friend class decimal_column;
+
+        constexpr reference(decimal_column* column, const size_type index) noexcept : column_ {column}, index_ {index} {}
+
+    public:
+        operator value_type() const noexcept { return column_->load(index_); }
+
+        auto operator=(const value_type val) noexcept -> reference&
+        {
+            column_->store(index_, val);
+            return *this;
+        }
+
+        auto operator=(const reference& other) noexcept -> reference&
+        {
+            return *this = static_cast<value_type>(other);
+        }
+    };
+
+    using const_reference = value_type;
+
+private:
+    template <typename T>
+    using lane = std::vector<T, detail::column_allocator<T, alignment>>;
+
+    using key_type = detail::column_key_type<DecimalType>;
+
+    lane<significand_type> significands_;
+    lane<exponent_type> exponents_;
+    lane<sign_type> signs_;
+
+    auto load(const size_type i) const noexcept -> value_type
+    {
+        return detail::column_make<DecimalType>(significands_[i], exponents_[i], signs_[i] != 0U);
+    }
+
+    auto store(const size_type i, const value_type val) noexcept -> void
+    {
+        const auto components {detail::get_components(val)};
+        significands_[i] = components.sig;
+        exponents_[i] = static_cast<exponent_type>(components.exp + detail::bias_v<DecimalType>);
+        signs_[i] = static_cast<sign_type>(components.sign);
+    }
+
+    auto key(const size_type i) const noexcept -> key_type
+    {
+        return detail::column_key<DecimalType>(significands_[i], exponents_[i], signs_[i] != 0U);
+    }
+
+    auto block_has_non_finite(size_type first, size_type n) const noexcept -> bool;
+
+    template <typename Operation>
+    auto apply(const decimal_column& rhs) noexcept -> decimal_column&;
+
+    template <typename Operation>
+    auto apply(value_type rhs) noexcept -> decimal_column&;
+
+    template <typename Comparison>
+    auto compare(value_type rhs, bool* out) const noexcept -> void;
+
+    template <typename Comparison>
+    auto select() const noexcept -> value_type;
+
+public:
+    decimal_column() = default;
+
+    // A column of n zeros
+    explicit decimal_column(const size_type n) : significands_(n), exponents_(n), signs_(n) {}
+
+    // Converts n values of any decimal type
+    template <typename T, std::enable_if_t<detail::is_decimal_floating_point_v<T>, bool> = true>
+    decimal_column(const T* values, const size_type n) : decimal_column(n) { assign(values, n); }
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    template <typename T, std::enable_if_t<detail::is_decimal_floating_point_v<T>, bool> = true>
+    explicit decimal_column(std::span<const T> values) : decimal_column(values.data(), values.size()) {}
+
+    #endif
+
+    auto size() const noexcept -> size_type { return significands_.size(); }
+    auto empty() const noexcept -> bool { return significands_.empty(); }
+
+    auto resize(size_type n) -> void;
+    auto reserve(size_type n) -> void;
+    auto clear() noexcept -> void;
+    auto push_back(value_type val) -> void;
+
+    auto operator[](const size_type i) noexcept -> reference { return reference {this, i}; }
+    auto operator[](const size_type i) const noexcept -> const_reference { return load(i); }
+
+    // Direct access to the lanes. Exponents are stored biased as in the value type,
+    // and signs are 0 for positive values and 1 for negative ones.
+    auto significands() const noexcept -> const significand_type* { return significands_.data(); }
+    auto exponents() const noexcept -> const exponent_type* { return exponents_.data(); }
+    auto signs() const noexcept -> const sign_type* { return signs_.data(); }
+
+    // Replaces the contents with n values of any decimal type
+    template <typename T>
+    auto assign(const T* values, size_type n)
+        BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void);
+
+    // Converts the values to any decimal type, out must hold size() elements
+    template <typename T>
+    auto copy_to(T* out) const noexcept
+        BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void);
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    template <typename T>
+    auto assign(std::span<const T> values)
+        BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void);
+
+    // The number of elements converted is the smaller of the two sizes
+    template <typename T>
+    auto copy_to(std::span<T> out) const noexcept
+        BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void);
+
+    #endif
+
+    // Element-wise arithmetic. The results are identical to those of the scalar operators.
+    // Both columns must be the same size.
+    // Each element is rebuilt from the lanes and computed as by the operator, so these gain nothing from the layout.
+    auto operator+=(const decimal_column& rhs) noexcept -> decimal_column& { return apply<detail::column_plus>(rhs); }
+    auto operator-=(const decimal_column& rhs) noexcept -> decimal_column& { return apply<detail::column_minus>(rhs); }
+    auto operator*=(const decimal_column& rhs) noexcept -> decimal_column& { return apply<detail::column_multiplies>(rhs); }
+
+    auto operator+=(const value_type rhs) noexcept -> decimal_column& { return apply<detail::column_plus>(rhs); }
+    auto operator-=(const value_type rhs) noexcept -> decimal_column& { return apply<detail::column_minus>(rhs); }
+    auto operator*=(const value_type rhs) noexcept -> decimal_column& { return apply<detail::column_multiplies>(rhs); }
+
+    // Compares each element against val, and writes the results to out which must hold size() elements.
+    // The results are identical to those of the scalar operators.
+    auto less(const value_type val, bool* out) const noexcept -> void { compare<detail::column_less>(val, out); }
+    auto less_equal(const value_type val, bool* out) const noexcept -> void { compare<detail::column_less_equal>(val, out); }
+    auto greater(const value_type val, bool* out) const noexcept -> void { compare<detail::column_greater>(val, out); }
+    auto greater_equal(const value_type val, bool* out) const noexcept -> void { compare<detail::column_greater_equal>(val, out); }
+    auto equal(const value_type val, bool* out) const noexcept -> void { compare<detail::column_equal>(val, out); }
+    auto not_equal(const value_type val, bool* out) const noexcept -> void { compare<detail::column_not_equal>(val, out); }
+
+    // Reductions
+
+    // Returns the sum of the elements in order, i.e. ((x[0] + x[1]) + x[2]) + ...
+    // An empty column sums to zero. Like the arithmetic, this is no faster than a loop over a std::vector.
+    auto sum() const noexcept -> value_type;
+
+    // Returns the smallest (largest) element ignoring NaNs.
+    // An empty column, or one of only NaNs, returns a quiet NaN.
+    auto min() const noexcept -> value_type { return select<detail::column_less>(); }
+    auto max() const noexcept -> value_type { return select<detail::column_greater>(); }
+};
+
+template <typename DecimalType>
+auto decimal_column<DecimalType>::block_has_non_finite(const size_type first, const size_type n) const noexcept -> bool
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    unsigned special {};
+    for (size_type i {first}; i < first + n; ++i)
+    {
+        special |= static_cast<unsigned>(not_finite(detail::column_make<DecimalType>(significands_[i], exponents_[i], false)));
+    }
+
+    return special != 0U;
+    #else
+    static_cast<void>(first);
+    static_cast<void>(n);
+    return false;
+    #endif
+}
+
+template <typename DecimalType>
+auto decimal_column<DecimalType>::resize(const size_type n) -> void
+{
+    significands_.resize(n);
+    exponents_.resize(n);
+    signs_.resize(n);
+}
+
+template <typename DecimalType>
+auto decimal_column<DecimalType>::reserve(const size_type n) -> void
+{
+    significands_.reserve(n);
+    exponents_.reserve(n);
+    signs_.reserve(n);
+}
+
+template <typename DecimalType>
+auto decimal_column<DecimalType>::clear() noexcept -> void
+{
+    significands_.clear();
+    exponents_.clear();
+    signs_.clear();
+}
+
+template <typename DecimalType>
+auto decimal_column<DecimalType>::push_back(const value_type val) -> void
+{
+    const auto components {detail::get_components(val)};
+    significands_.push_back(components.sig);
+    exponents_.push_back(static_cast<exponent_type>(components.exp + detail::bias_v<DecimalType>));
+    signs_.push_back(static_cast<sign_type>(components.sign));
+}
+
+template <typename DecimalType>
+template <typename T>
+auto decimal_column<DecimalType>::assign(const T* values, const size_type n)
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void)
+{
+    resize(n);
+
+    for (size_type i {}; i < n; ++i)
+    {
+        store(i, static_cast<value_type>(values[i]));
+    }
+}
+
+template <typename DecimalType>
+template <typename T>
+auto decimal_column<DecimalType>::copy_to(T* out) const noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void)
+{
+    for (size_type i {}; i < size(); ++i)
+    {
+        out[i] = static_cast<T>(load(i));
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+template <typename T>
+auto decimal_column<DecimalType>::assign(std::span<const T> values)
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void)
+{
+    assign(values.data(), values.size());
+}
+
+template <typename DecimalType>
+template <typename T>
+auto decimal_column<DecimalType>::copy_to(std::span<T> out) const noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void)
+{
+    BOOST_DECIMAL_ASSERT(out.size() == size());
+
+    const auto n {out.size() < size() ? out.size() : size()};
+    for (size_type i {}; i < n; ++i)
+    {
+        out[i] = static_cast<T>(load(i));
+    }
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+template <typename Operation>
+auto decimal_column<DecimalType>::apply(const decimal_column& rhs) noexcept -> decimal_column&
+{
+    BOOST_DECIMAL_ASSERT(rhs.size() == size());
+
+    const auto n {size()};
+
+    size_type i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(block_has_non_finite(i, block) || rhs.block_has_non_finite(i, block)))
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                store(j, Operation::scalar(load(j), rhs.load(j)));
+            }
+        }
+        else
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                store(j, Operation::finite(load(j), rhs.load(j)));
+            }
+        }
+
+        i += block;
+    }
+
+    return *this;
+}
+
+template <typename DecimalType>
+template <typename Operation>
+auto decimal_column<DecimalType>::apply(const value_type rhs) noexcept -> decimal_column&
+{
+    const auto n {size()};
+    const bool rhs_is_finite {isfinite(rhs)};
+
+    size_type i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(!rhs_is_finite || block_has_non_finite(i, block)))
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                store(j, Operation::scalar(load(j), rhs));
+            }
+        }
+        else
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                store(j, Operation::finite(load(j), rhs));
+            }
+        }
+
+        i += block;
+    }
+
+    return *this;
+}
+
+template <typename DecimalType>
+template <typename Comparison>
+auto decimal_column<DecimalType>::compare(const value_type rhs, bool* out) const noexcept -> void
+{
+    const auto n {size()};
+    const bool rhs_is_finite {isfinite(rhs)};
+
+    const auto rhs_components {detail::get_components(rhs)};
+    const auto rhs_key {detail::column_key<DecimalType>(rhs_components.sig,
+                                                        static_cast<exponent_type>(rhs_components.exp + detail::bias_v<DecimalType>),
+                                                        rhs_components.sign)};
+
+    size_type i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(!rhs_is_finite || block_has_non_finite(i, block)))
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                out[j] = Comparison::scalar(load(j), rhs);
+            }
+        }
+        else
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                out[j] = Comparison::template key<DecimalType>(key(j), rhs_key);
+            }
+        }
+
+        i += block;
+    }
+}
+
+template <typename DecimalType>
+auto decimal_column<DecimalType>::sum() const noexcept -> value_type
+{
+    if (empty())
+    {
+        return value_type{0};
+    }
+
+    // The running sum can become non-finite at any point, so each step uses the operator
+    auto res {load(0)};
+    for (size_type i {1}; i < size(); ++i)
+    {
+        res += load(i);
+    }
+
+    return res;
+}
+
+template <typename DecimalType>
+template <typename Comparison>
+auto decimal_column<DecimalType>::select() const noexcept -> value_type
+{
+    const auto n {size()};
+
+    value_type res {std::numeric_limits<value_type>::quiet_NaN()};
+    bool found {};
+
+    size_type i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(block_has_non_finite(i, block)))
+        {
+            for (size_type j {i}; j < i + block; ++j)
+            {
+                const auto val {load(j)};
+                if (!isnan(val) && (!found || Comparison::scalar(val, res)))
+                {
+                    res = val;
+                    found = true;
+                }
+            }
+        }
+        else
+        {
+            // Only the position of the best key is tracked within the block
+            auto best {i};
+            auto best_key {key(i)};
+            for (size_type j {i + 1U}; j < i + block; ++j)
+            {
+                const auto current_key {key(j)};
+                if (Comparison::template key<DecimalType>(current_key, best_key))
+                {
+                    best_key = current_key;
+                    best = j;
+                }
+            }
+
+            const auto val {load(best)};
+            if (!found || Comparison::scalar(val, res))
+            {
+                res = val;
+                found = true;
+            }
+        }
+
+        i += block;
+    }
+
+    return res;
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECIMAL_COLUMN_HPP
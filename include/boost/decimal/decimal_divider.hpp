@@ -0,0 +1,377 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECIMAL_DIVIDER_HPP
+#define BOOST_DECIMAL_DECIMAL_DIVIDER_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/normalize.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/invariant_div.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The decoded divisor along with the reciprocal of its significand
+template <typename DecimalType>
+struct divider_divisor
+{
+    // The components as used by operator/
+    components_type<DecimalType> components {};
+    invariant_divisor div {};
+
+    // decimal128_t only:
+    // operator/ truncates quotients of more than 128 bits to 38 digits, and floor(floor(n / d) / 10^k) == floor(n / (d * 10^k)).
+    // The expanded dividend is in [10^67, 10^68), so those quotients have one of two digit counts,
+    // which is decided by comparing the dividend against the thresholds.
+    // Each truncation is then folded into a divisor of its own.
+    u256 wide_threshold {};
+    u256 digits_threshold {};
+    invariant_divisor wide_div {};
+    invariant_divisor wider_div {};
+    std::int32_t wide_digits {};
+    bool has_wide_quotients {};
+};
+
+// Only decimal32_t expands the divisor before dividing
+template <typename DecimalType>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto make_divider_divisor(const DecimalType divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value, divider_divisor<DecimalType>>
+{
+    divider_divisor<DecimalType> res {};
+    res.components = get_components(divisor);
+    expand_significand<DecimalType>(res.components.sig, res.components.exp);
+    res.div = invariant_divisor{res.components.sig};
+
+    return res;
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto make_divider_divisor(const DecimalType divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal64_t>::value ||
+                        std::is_same<DecimalType, decimal_fast32_t>::value ||
+                        std::is_same<DecimalType, decimal_fast64_t>::value ||
+                        std::is_same<DecimalType, decimal_fast128_t>::value, divider_divisor<DecimalType>>
+{
+    divider_divisor<DecimalType> res {};
+    res.components = get_components(divisor);
+    res.div = invariant_divisor{res.components.sig};
+
+    return res;
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto make_divider_divisor(const DecimalType divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value, divider_divisor<DecimalType>>
+{
+    constexpr auto max_digits {std::numeric_limits<int128::uint128_t>::digits10};
+
+    divider_divisor<DecimalType> res {};
+    res.components = get_components(divisor);
+
+    const auto& d {res.components.sig};
+    res.div = invariant_divisor{d};
+
+    // The smallest quotient has this many digits, and the largest one more
+    constexpr auto min_dividend {umul256(pow10(int128::uint128_t(precision_v<decimal128_t>)),
+                                         pow10(int128::uint128_t(precision_v<decimal128_t> - 1)))};
+    const auto digits {num_digits(min_dividend / d)};
+
+    // Quotients of 38 digits or fewer always fit in 128 bits
+    if (digits >= max_digits)
+    {
+        res.wide_digits = digits - max_digits;
+        res.has_wide_quotients = true;
+
+        const auto wide_divisor {d * pow10(int128::uint128_t(res.wide_digits))};
+        res.wide_div = invariant_divisor{wide_divisor};
+        res.wider_div = invariant_divisor{wide_divisor * 10U};
+
+        res.wide_threshold = u256{d, int128::uint128_t{0U}};
+        res.digits_threshold = umul256(wide_divisor, pow10(int128::uint128_t(max_digits)));
+    }
+
+    return res;
+}
+
+// Returns the same zero as operator/ for a zero dividend
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto divider_zero(const bool sign) noexcept -> DecimalType
+{
+    constexpr DecimalType zero {0, 0};
+    return sign ? -zero : zero;
+}
+
+// Mirrors generic_div_impl
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto divider_div(const DecimalType val, const divider_divisor<DecimalType>& divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value || std::is_same<DecimalType, decimal_fast32_t>::value, DecimalType>
+{
+    constexpr auto precision_offset {std::numeric_limits<std::uint64_t>::digits10 - precision_v<DecimalType>};
+    constexpr auto ten_pow_offset {pow10(static_cast<std::uint64_t>(precision_offset))};
+
+    auto x {get_components(val)};
+    const bool sign {x.sign != divisor.components.sign};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (x.sig == 0U)
+    {
+        return divider_zero<DecimalType>(sign);
+    }
+    #endif
+
+    BOOST_DECIMAL_IF_CONSTEXPR (std::is_same<DecimalType, decimal32_t>::value)
+    {
+        expand_significand<DecimalType>(x.sig, x.exp);
+    }
+
+    const auto big_sig {static_cast<std::uint64_t>(x.sig) * ten_pow_offset};
+    auto res_sig {invariant_div(big_sig, divisor.div)};
+    const auto res_exp {(x.exp - precision_offset) - divisor.components.exp};
+
+    if (res_sig * divisor.components.sig != big_sig)
+    {
+        res_sig |= 1U;
+    }
+
+    return DecimalType{res_sig, res_exp, sign};
+}
+
+// Mirrors d64_generic_div_impl
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto divider_div(const DecimalType val, const divider_divisor<DecimalType>& divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal64_t>::value || std::is_same<DecimalType, decimal_fast64_t>::value, DecimalType>
+{
+    constexpr auto offset {std::numeric_limits<int128::uint128_t>::digits10 - precision_v<decimal64_t>};
+    constexpr auto tens_needed {pow10(static_cast<int128::uint128_t>(offset))};
+
+    auto x {get_components(val)};
+    const bool sign {x.sign != divisor.components.sign};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (x.sig == 0U)
+    {
+        return divider_zero<DecimalType>(sign);
+    }
+    #endif
+
+    BOOST_DECIMAL_IF_CONSTEXPR (std::is_same<DecimalType, decimal64_t>::value)
+    {
+        expand_significand<DecimalType>(x.sig, x.exp);
+    }
+
+    const auto big_sig {static_cast<int128::uint128_t>(x.sig) * tens_needed};
+    auto res_sig {invariant_div(big_sig, divisor.div)};
+    const auto res_exp {(x.exp - offset) - divisor.components.exp};
+
+    if (res_sig * divisor.components.sig != big_sig)
+    {
+        res_sig |= 1U;
+    }
+
+    return DecimalType{res_sig, res_exp, sign};
+}
+
+// Mirrors d128_generic_div_impl
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto divider_div(const DecimalType val, const divider_divisor<DecimalType>& divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value, DecimalType>
+{
+    constexpr auto ten_pow_precision {pow10(int128::uint128_t(precision_v<decimal128_t>))};
+
+    auto x {get_components(val)};
+    const bool sign {x.sign != divisor.components.sign};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (x.sig == 0U)
+    {
+        return divider_zero<DecimalType>(sign);
+    }
+    #endif
+
+    expand_significand<DecimalType>(x.sig, x.exp);
+
+    const auto big_sig {umul256(x.sig, ten_pow_precision)};
+    auto res_exp {x.exp - divisor.components.exp - precision_v<decimal128_t>};
+
+    u256 res_sig {};
+    if (divisor.has_wide_quotients && !(big_sig < divisor.wide_threshold))
+    {
+        if (big_sig < divisor.digits_threshold)
+        {
+            res_sig = invariant_div(big_sig, divisor.wide_div);
+            res_exp += divisor.wide_digits;
+        }
+        else
+        {
+            res_sig = invariant_div(big_sig, divisor.wider_div);
+            res_exp += divisor.wide_digits + 1;
+        }
+    }
+    else
+    {
+        res_sig = invariant_div(big_sig, divisor.div);
+    }
+
+    return DecimalType{int128::uint128_t{res_sig[1], res_sig[0]}, res_exp, sign};
+}
+
+// Mirrors d128f_div_impl, where the quotient always fits in 128 bits since both significands are normalized
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto divider_div(const DecimalType val, const divider_divisor<DecimalType>& divisor) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast128_t>::value, DecimalType>
+{
+    constexpr auto ten_pow_precision {pow10(int128::uint128_t(precision_v<decimal_fast128_t>))};
+
+    const auto x {get_components(val)};
+    const bool sign {x.sign != divisor.components.sign};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (x.sig == 0U)
+    {
+        return divider_zero<DecimalType>(sign);
+    }
+    #endif
+
+    const auto res_sig {invariant_div(umul256(x.sig, ten_pow_precision), divisor.div)};
+    const auto res_exp {x.exp - divisor.components.exp - precision_v<decimal_fast128_t>};
+
+    return DecimalType{int128::uint128_t{res_sig[1], res_sig[0]}, res_exp, sign};
+}
+
+} // namespace detail
+
+// Divides values by a fixed divisor.
+// The divisor is decoded once on construction and the reciprocal of its significand is computed,
+// so that each division is carried out with multiplications in place of a hardware (or long) division.
+// The results are identical to those of the scalar operator/.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class decimal_divider
+{
+    static_assert(detail::is_decimal_floating_point_v<DecimalType>, "decimal_divider requires a decimal floating point type");
+
+public:
+    using value_type = DecimalType;
+
+private:
+    DecimalType divisor_ {};
+    detail::divider_divisor<DecimalType> data_ {};
+
+    // Zero and non-finite divisors are left to operator/
+    bool divisor_is_usable_ {};
+
+public:
+    explicit BOOST_DECIMAL_CUDA_CONSTEXPR decimal_divider(const DecimalType divisor) noexcept
+        : divisor_ {divisor}, divisor_is_usable_ {isfinite(divisor) && detail::get_components(divisor).sig != 0U}
+    {
+        if (divisor_is_usable_)
+        {
+            data_ = detail::make_divider_divisor(divisor);
+        }
+    }
+
+    constexpr auto divisor() const noexcept -> DecimalType { return divisor_; }
+
+    // Returns x / divisor()
+    constexpr auto operator()(DecimalType x) const noexcept -> DecimalType;
+
+    // Computes out[i] = in[i] / divisor() for i in [0, n)
+    // out may be the same array as in, but must not otherwise overlap it.
+    constexpr auto divide(const DecimalType* in, DecimalType* out, std::size_t n) const noexcept -> void;
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    // The number of elements processed is the smaller of the two sizes
+    constexpr auto divide(std::span<const DecimalType> in, std::span<DecimalType> out) const noexcept -> void;
+
+    #endif
+};
+
+template <typename DecimalType>
+constexpr auto decimal_divider<DecimalType>::operator()(const DecimalType x) const noexcept -> DecimalType
+{
+    if (!divisor_is_usable_)
+    {
+        return x / divisor_;
+    }
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(x))
+    {
+        return x / divisor_;
+    }
+    #endif
+
+    return detail::divider_div(x, data_);
+}
+
+template <typename DecimalType>
+constexpr auto decimal_divider<DecimalType>::divide(const DecimalType* in, DecimalType* out, const std::size_t n) const noexcept -> void
+{
+    // A local copy keeps the cached divisor in registers,
+    // since otherwise every store to out could alias it
+    const auto data {data_};
+
+    std::size_t i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(!divisor_is_usable_ || detail::batch_has_non_finite(in + i, block)))
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                out[j] = in[j] / divisor_;
+            }
+        }
+        else
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                out[j] = detail::divider_div(in[j], data);
+            }
+        }
+
+        i += block;
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+constexpr auto decimal_divider<DecimalType>::divide(std::span<const DecimalType> in, std::span<DecimalType> out) const noexcept -> void
+{
+    BOOST_DECIMAL_ASSERT(in.size() == out.size());
+
+    divide(in.data(), out.data(), in.size() < out.size() ? in.size() : out.size());
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECIMAL_DIVIDER_HPP
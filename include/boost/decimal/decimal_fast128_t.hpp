@@ -56,10 +56,28 @@ namespace decimal {
 
 namespace detail {
 
+#ifdef BOOST_DECIMAL_COMPACT_FAST128
+
+// The low 113 bits of the significand word hold the significand,
+// the next 14 bits hold the biased exponent, and the top bit holds the sign.
+// Non-finite values are marked by exponent fields above the largest finite biased exponent (12287).
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_inf_high_bits {UINT64_C(0b011) << 61U};
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_qnan_high_bits {UINT64_C(0b0111) << 60U};
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_snan_high_bits {UINT64_C(0b01111) << 59U};
+
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_sign_mask {UINT64_C(1) << 63U};
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_exponent_shift {49U};
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_exponent_mask {UINT64_C(0x3FFF)};
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_significand_high_mask {(UINT64_C(1) << 49U) - 1U};
+
+#else
+
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_inf_high_bits {UINT64_C(0b1) << 61U};
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_qnan_high_bits {UINT64_C(0b11) << 61U};
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_snan_high_bits {UINT64_C(0b111) << 61U};
 
+#endif // BOOST_DECIMAL_COMPACT_FAST128
+
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_inf = boost::int128::uint128_t {d128_fast_inf_high_bits, 0U};
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_qnan = boost::int128::uint128_t {d128_fast_qnan_high_bits, 0U};
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE auto d128_fast_snan = boost::int128::uint128_t {d128_fast_snan_high_bits, 0U};
@@ -98,29 +116,75 @@ private:
     // Instead of having to encode and decode at every operation
     // we store the constituent pieces directly
 
+    #ifdef BOOST_DECIMAL_COMPACT_FAST128
+
+    // The significand needs at most 113 bits, so the exponent and sign
+    // are packed into the spare high bits of the significand word
+    significand_type significand_ {};
+
+    #else
+
     significand_type significand_ {};
     exponent_type exponent_ {};
     bool sign_ {};
     char pad_[11] {};
 
+    #endif // BOOST_DECIMAL_COMPACT_FAST128
+
     constexpr auto isneg() const noexcept -> bool
     {
+        #ifdef BOOST_DECIMAL_COMPACT_FAST128
+        return (significand_.high & detail::d128_fast_sign_mask) != 0U;
+        #else
         return sign_;
+        #endif
     }
 
     constexpr auto full_significand() const noexcept -> significand_type
     {
+        #ifdef BOOST_DECIMAL_COMPACT_FAST128
+        return significand_type{significand_.high & detail::d128_fast_significand_high_mask, significand_.low};
+        #else
         return significand_;
+        #endif
     }
 
     constexpr auto unbiased_exponent() const noexcept -> exponent_type
     {
+        #ifdef BOOST_DECIMAL_COMPACT_FAST128
+        return static_cast<exponent_type>((significand_.high >> detail::d128_fast_exponent_shift) & detail::d128_fast_exponent_mask);
+        #else
         return exponent_;
+        #endif
+    }
+
+    // The high word of the significand without the sign, which holds the markers of the non-finite values
+    constexpr auto high_bits() const noexcept -> std::uint64_t
+    {
+        #ifdef BOOST_DECIMAL_COMPACT_FAST128
+        return significand_.high & ~detail::d128_fast_sign_mask;
+        #else
+        return significand_.high;
+        #endif
+    }
+
+    constexpr auto set_components(const significand_type significand, const exponent_type exponent, const bool sign) noexcept -> void
+    {
+        #ifdef BOOST_DECIMAL_COMPACT_FAST128
+        significand_ = significand_type{significand.high |
+                                        (static_cast<std::uint64_t>(exponent) << detail::d128_fast_exponent_shift) |
+                                        (static_cast<std::uint64_t>(sign) << 63U),
+                                        significand.low};
+        #else
+        significand_ = significand;
+        exponent_ = exponent;
+        sign_ = sign;
+        #endif
     }
 
     constexpr auto biased_exponent() const noexcept -> biased_exponent_type
     {
-        return static_cast<biased_exponent_type>(exponent_) - detail::bias_v<decimal_fast128_t>;
+        return static_cast<biased_exponent_type>(unbiased_exponent()) - detail::bias_v<decimal_fast128_t>;
     }
 
     constexpr auto to_components() const noexcept -> detail::decimal_fast128_t_components
@@ -190,6 +254,9 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
+    template <typename DecimalType>
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::get_components(const DecimalType& val) noexcept -> detail::components_type<DecimalType>;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
@@ -227,9 +294,12 @@ private:
     template <typename Decimal>
     friend constexpr Decimal detail::check_non_finite(Decimal x) noexcept;
 
-    template <typename ReturnType, typename T>
+    template <typename ReturnType, rounding_mode Mode, typename T>
     friend constexpr auto detail::d128_add_impl_new(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
+    template <typename ReturnType, rounding_mode Mode, typename T>
+    friend constexpr auto detail::add_same_exponent(const T& lhs, const T& rhs) noexcept -> ReturnType;
+
 public:
     constexpr decimal_fast128_t() noexcept = default;
 
@@ -520,14 +590,12 @@ constexpr decimal_fast128_t::decimal_fast128_t(T1 coeff, T2 exp, const detail::c
     minimum_coefficient_size min_coeff {coeff};
 
     const auto is_negative {static_cast<bool>(resultant_sign)};
-    sign_ = is_negative;
 
     // IEEE 754-2008 3.5.1: zero has a cohort with one representation per exponent.
     // Skip normalization for zero (which would otherwise expand the significand and shift the exponent)
     // and clamp the requested exponent to the representable range.
     if (min_coeff == minimum_coefficient_size{0})
     {
-        significand_ = static_cast<significand_type>(0);
         auto biased_exp {static_cast<int>(exp) + detail::bias_v<decimal_fast128_t>};
         if (biased_exp < 0)
         {
@@ -537,7 +605,7 @@ constexpr decimal_fast128_t::decimal_fast128_t(T1 coeff, T2 exp, const detail::c
         {
             biased_exp = detail::max_biased_exp_v<decimal_fast128_t>;
         }
-        exponent_ = static_cast<exponent_type>(biased_exp);
+        set_components(static_cast<significand_type>(0), static_cast<exponent_type>(biased_exp), is_negative);
         return;
     }
 
@@ -545,23 +613,22 @@ constexpr decimal_fast128_t::decimal_fast128_t(T1 coeff, T2 exp, const detail::c
     // to calculate the number of digits for operations
     detail::normalize<decimal_fast128_t>(min_coeff, exp, is_negative);
 
-    significand_ = static_cast<significand_type>(min_coeff);
-
     const auto biased_exp {static_cast<int>(exp) + detail::bias_v<decimal_fast128_t>};
 
     if (biased_exp > detail::max_biased_exp_v<decimal_fast128_t>)
     {
-        significand_ = detail::d128_fast_inf;
+        detail::raise_status(status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
+        set_components(detail::d128_fast_inf, 0U, is_negative);
     }
     else if (biased_exp >= 0)
     {
-        exponent_ = static_cast<exponent_type>(biased_exp);
+        set_components(static_cast<significand_type>(min_coeff), static_cast<exponent_type>(biased_exp), is_negative);
     }
     else
     {
         // Flush denorms to zero, preserving sign per IEEE 754-2008 3.5.1
-        significand_ = static_cast<significand_type>(0);
-        exponent_ = static_cast<exponent_type>(0);
+        detail::raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
+        set_components(static_cast<significand_type>(0), 0U, is_negative);
     }
 }
 
@@ -599,11 +666,11 @@ BOOST_DECIMAL_CXX20_CONSTEXPR decimal_fast128_t::decimal_fast128_t(const Float v
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (val != val)
     {
-        significand_ = detail::d128_fast_qnan;
+        set_components(detail::d128_fast_qnan, 0U, false);
     }
     else if (val == std::numeric_limits<Float>::infinity() || val == -std::numeric_limits<Float>::infinity())
     {
-        significand_ = detail::d128_fast_inf;
+        set_components(detail::d128_fast_inf, 0U, false);
     }
     else
     #endif
@@ -624,9 +691,7 @@ constexpr auto direct_init_d128(const decimal_fast128_t::significand_type signif
                                 const bool sign) noexcept -> decimal_fast128_t
 {
     decimal_fast128_t val {};
-    val.significand_ = significand;
-    val.exponent_ = exponent;
-    val.sign_ = sign;
+    val.set_components(significand, exponent, sign);
 
     return val;
 }
@@ -739,13 +804,13 @@ namespace decimal {
 
 constexpr auto signbit(const decimal_fast128_t& val) noexcept -> bool
 {
-    return val.sign_;
+    return val.isneg();
 }
 
 constexpr auto isinf(const decimal_fast128_t& val) noexcept -> bool
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
-    return val.significand_.high == detail::d128_fast_inf_high_bits;
+    return val.high_bits() == detail::d128_fast_inf_high_bits;
     #else
     static_cast<void>(val);
     return false;
@@ -755,7 +820,7 @@ constexpr auto isinf(const decimal_fast128_t& val) noexcept -> bool
 constexpr auto isnan(const decimal_fast128_t& val) noexcept -> bool
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
-    return val.significand_.high >= detail::d128_fast_qnan_high_bits;
+    return val.high_bits() >= detail::d128_fast_qnan_high_bits;
     #else
     static_cast<void>(val);
     return false;
@@ -765,7 +830,7 @@ constexpr auto isnan(const decimal_fast128_t& val) noexcept -> bool
 constexpr auto issignaling(const decimal_fast128_t& val) noexcept -> bool
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
-    return val.significand_.high >= detail::d128_fast_snan_high_bits;
+    return val.high_bits() >= detail::d128_fast_snan_high_bits;
     #else
     static_cast<void>(val);
     return false;
@@ -775,21 +840,21 @@ constexpr auto issignaling(const decimal_fast128_t& val) noexcept -> bool
 constexpr auto isnormal(const decimal_fast128_t& val) noexcept -> bool
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
-    if (val.exponent_ <= static_cast<decimal_fast128_t::exponent_type>(detail::precision_v<decimal_fast128_t> - 1))
+    if (val.unbiased_exponent() <= static_cast<decimal_fast128_t::exponent_type>(detail::precision_v<decimal_fast128_t> - 1))
     {
         return false;
     }
 
-    return (val.significand_ != 0U) && isfinite(val);
+    return (val.full_significand() != 0U) && isfinite(val);
     #else
-    return val.significand_ != 0U;
+    return val.full_significand() != 0U;
     #endif
 }
 
 constexpr auto isfinite(const decimal_fast128_t& val) noexcept -> bool
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
-    return val.significand_.high < detail::d128_fast_inf_high_bits;
+    return val.high_bits() < detail::d128_fast_inf_high_bits;
     #else
     static_cast<void>(val);
     return true;
@@ -799,7 +864,7 @@ constexpr auto isfinite(const decimal_fast128_t& val) noexcept -> bool
 BOOST_DECIMAL_FORCE_INLINE constexpr auto not_finite(const decimal_fast128_t& val) noexcept -> bool
 {
     #ifndef BOOST_DECIMAL_FAST_MATH
-    return val.significand_.high >= detail::d128_fast_inf_high_bits;
+    return val.high_bits() >= detail::d128_fast_inf_high_bits;
     #else
     static_cast<void>(val);
     return false;
@@ -1038,7 +1103,12 @@ constexpr auto operator+(const decimal_fast128_t& rhs) noexcept -> decimal_fast1
 
 constexpr auto operator-(decimal_fast128_t rhs) noexcept -> decimal_fast128_t
 {
+    #ifdef BOOST_DECIMAL_COMPACT_FAST128
+    rhs.significand_.high ^= detail::d128_fast_sign_mask;
+    #else
     rhs.sign_ = !rhs.sign_;
+    #endif
+
     return rhs;
 }
 
@@ -1049,6 +1119,7 @@ constexpr auto operator+(const decimal_fast128_t& lhs, const decimal_fast128_t&
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) != signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init_d128(detail::d128_fast_qnan, 0, false);
         }
 
@@ -1095,6 +1166,7 @@ constexpr auto operator-(const decimal_fast128_t& lhs, const decimal_fast128_t&
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init_d128(detail::d128_fast_qnan, 0, false);
         }
         if (isinf(rhs) && !isnan(lhs))
@@ -1157,6 +1229,7 @@ constexpr auto operator*(const decimal_fast128_t& lhs, const decimal_fast128_t&
     {
         if ((isinf(lhs) && rhs == 0) || (isinf(rhs) && lhs == 0))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init_d128(detail::d128_fast_qnan, 0, false);
         }
         else if (isinf(lhs) && !isnan(rhs) && (signbit(lhs) != signbit(rhs)))
@@ -1180,8 +1253,8 @@ constexpr auto operator*(const decimal_fast128_t& lhs, const decimal_fast128_t&
     }
     #endif
 
-    return detail::d128_mul_impl<decimal_fast128_t>(lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-                                                 rhs.significand_, rhs.biased_exponent(), rhs.sign_);
+    return detail::d128_mul_impl<decimal_fast128_t>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                 rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
 }
 
 template <typename Integer>
@@ -1206,13 +1279,13 @@ constexpr auto operator*(const decimal_fast128_t& lhs, const Integer rhs) noexce
     }
     #endif
 
-    auto rhs_sig {static_cast<int128::uint128_t>(detail::make_positive_unsigned(rhs))};
-    exp_type rhs_exp {0};
-    detail::normalize<decimal_fast128_t>(rhs_sig, rhs_exp);
+    // The integer is used directly as a significand with exponent 0,
+    // and the exact product is rounded once
+    const auto rhs_sig {static_cast<int128::uint128_t>(detail::make_positive_unsigned(rhs))};
 
-    return detail::d128_fast_mul_impl<decimal_fast128_t>(
-            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-            rhs_sig, rhs_exp, (rhs < 0));
+    return detail::d128_mul_impl<decimal_fast128_t>(
+            lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+            rhs_sig, exp_type{0}, (rhs < 0));
 }
 
 template <typename Integer>
@@ -1240,6 +1313,11 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
         // NAN has to come first
         if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
         {
+            if (issignaling(lhs) || issignaling(rhs))
+            {
+                detail::raise_status(status_flags::fe_dec_invalid);
+            }
+
             // Operations on an SNAN return a QNAN with the same payload
             decimal_fast128_t return_nan {};
             if (lhs_fp == rhs_fp)
@@ -1277,6 +1355,7 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
             case FP_INFINITE:
                 if (rhs_fp == FP_INFINITE)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1289,6 +1368,7 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
             case FP_ZERO:
                 if (rhs_fp == FP_ZERO)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1305,6 +1385,7 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
         switch (rhs_fp)
         {
             case FP_ZERO:
+                detail::raise_status(status_flags::fe_dec_divbyzero);
                 q = inf;
                 r = zero;
                 return;
@@ -1328,11 +1409,18 @@ constexpr auto d128f_div_impl(const decimal_fast128_t& lhs, const decimal_fast12
     #endif
 
     constexpr auto ten_pow_precision {detail::pow10(int128::uint128_t(detail::precision_v<decimal_fast128_t>))};
-    const auto big_sig_lhs {detail::umul256(lhs.significand_, ten_pow_precision)};
+    const auto big_sig_lhs {detail::umul256(lhs.full_significand(), ten_pow_precision)};
 
-    const auto res_sig {big_sig_lhs / rhs.significand_};
+    const auto res_sig {big_sig_lhs / rhs.full_significand()};
     const auto res_exp {lhs.biased_exponent() - rhs.biased_exponent() - detail::precision_v<decimal_fast128_t>};
 
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+    if (big_sig_lhs % rhs.full_significand() != detail::u256{})
+    {
+        detail::raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
+
     q = decimal_fast128_t(static_cast<int128::uint128_t>(res_sig), res_exp, sign);
 }
 
@@ -1349,19 +1437,19 @@ template <typename Integer>
 constexpr auto operator/(const decimal_fast128_t& lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast128_t)
 {
+    const bool sign {lhs.isneg() != (rhs < 0)};
+
     #ifndef BOOST_DECIMAL_FAST_MATH
     // Check pre-conditions
     constexpr decimal_fast128_t zero {0, 0};
     constexpr decimal_fast128_t inf {direct_init_d128(detail::d128_fast_inf, 0, false)};
 
-    const bool sign {lhs.isneg() != (rhs < 0)};
-
     const auto lhs_fp {fpclassify(lhs)};
 
     switch (lhs_fp)
     {
         case FP_NAN:
-            return issignaling(lhs) ? nan_conversion(lhs) : lhs;;
+            return detail::check_non_finite(lhs);
         case FP_INFINITE:
             return sign ? -lhs : lhs;
         case FP_ZERO:
@@ -1372,19 +1460,12 @@ constexpr auto operator/(const decimal_fast128_t& lhs, const Integer rhs) noexce
 
     if (rhs == 0)
     {
+        detail::raise_status(status_flags::fe_dec_divbyzero);
         return sign ? -inf : inf;
     }
     #endif
 
-    const detail::decimal_fast128_t_components lhs_components {lhs.significand_, lhs.biased_exponent(), lhs.isneg()};
-
-    const auto rhs_sig {detail::make_positive_unsigned(rhs)};
-    const detail::decimal_fast128_t_components rhs_components {rhs_sig, 0, rhs < 0};
-    detail::decimal_fast128_t_components q_components {};
-
-    detail::d128_generic_div_impl(lhs_components, rhs_components, q_components);
-
-    return {q_components.sig, q_components.exp, q_components.sign};
+    return detail::d128_div_integer_impl<decimal_fast128_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), sign);
 }
 
 template <typename Integer>
@@ -1403,10 +1484,11 @@ constexpr auto operator/(const Integer lhs, const decimal_fast128_t& rhs) noexce
     switch (rhs_fp)
     {
         case FP_NAN:
-            return issignaling(rhs) ? nan_conversion(rhs) : rhs;
+            return detail::check_non_finite(rhs);
         case FP_INFINITE:
             return sign ? -zero : zero;
         case FP_ZERO:
+            detail::raise_status(status_flags::fe_dec_divbyzero);
             return sign ? -inf : inf;
         default:
             static_cast<void>(lhs);
@@ -1414,7 +1496,7 @@ constexpr auto operator/(const Integer lhs, const decimal_fast128_t& rhs) noexce
     #endif
 
     const detail::decimal_fast128_t_components lhs_components {detail::make_positive_unsigned(lhs), 0, lhs < 0};
-    const detail::decimal_fast128_t_components rhs_components {rhs.significand_, rhs.biased_exponent(), rhs.isneg()};
+    const detail::decimal_fast128_t_components rhs_components {rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
     detail::decimal_fast128_t_components q_components {};
 
     detail::d128_generic_div_impl(lhs_components, rhs_components, q_components);
@@ -1652,8 +1734,7 @@ constexpr decimal_fast128_t::operator Decimal() const noexcept
 
 constexpr auto copysignd128f(decimal_fast128_t mag, const decimal_fast128_t sgn) noexcept -> decimal_fast128_t
 {
-    mag.sign_ = sgn.sign_;
-    return mag;
+    return direct_init_d128(mag.full_significand(), mag.unbiased_exponent(), sgn.isneg());
 }
 
 constexpr auto scalblnd128f(decimal_fast128_t num, const long exp) noexcept -> decimal_fast128_t
@@ -1667,7 +1748,7 @@ constexpr auto scalblnd128f(decimal_fast128_t num, const long exp) noexcept -> d
     }
     #endif
 
-    num = decimal_fast128_t(num.significand_, num.biased_exponent() + exp, num.sign_);
+    num = decimal_fast128_t(num.full_significand(), num.biased_exponent() + exp, num.isneg());
 
     return num;
 }
@@ -167,10 +167,13 @@ private:
     friend constexpr auto to_dpd_d32(DecimalType val) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, std::uint32_t);
 
-    template <typename ReturnType, typename T>
+    template <typename ReturnType, rounding_mode Mode, typename T>
     friend constexpr auto detail::add_impl(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
-    template <typename ReturnType, typename T>
+    template <typename ReturnType, rounding_mode Mode, typename T>
+    friend constexpr auto detail::add_same_exponent(const T& lhs, const T& rhs) noexcept -> ReturnType;
+
+    template <typename ReturnType, rounding_mode Mode, typename T>
     friend constexpr auto detail::mul_impl(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
     template <BOOST_DECIMAL_FAST_DECIMAL_FLOATING_TYPE DecimalType>
@@ -190,6 +193,9 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
+    template <typename DecimalType>
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::get_components(const DecimalType& val) noexcept -> detail::components_type<DecimalType>;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
@@ -199,7 +205,7 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_cohort_preserving_scientific(char* first, char* last, const TargetDecimalType& value) noexcept -> to_chars_result;
 
-    template <typename DecimalType, typename T>
+    template <typename DecimalType, rounding_mode Mode, typename T>
     friend constexpr auto detail::generic_div_impl(const T& lhs, const T& rhs) noexcept -> DecimalType;
 
     template <typename TargetDecimalType, bool is_snan>
@@ -545,6 +551,7 @@ constexpr decimal_fast32_t::decimal_fast32_t(T1 coeff, T2 exp, const detail::con
     // decimal32_t exponent holds 8 bits
     if (biased_exp > detail::max_biased_exp_v<decimal_fast32_t>)
     {
+        detail::raise_status(status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
         significand_ = detail::d32_fast_inf;
     }
     else if (biased_exp >= 0)
@@ -554,6 +561,7 @@ constexpr decimal_fast32_t::decimal_fast32_t(T1 coeff, T2 exp, const detail::con
     else
     {
         // Flush denorms to zero, preserving sign per IEEE 754-2008 3.5.1
+        detail::raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
         significand_ = static_cast<significand_type>(0);
         exponent_ = static_cast<exponent_type>(0);
     }
@@ -1019,6 +1027,7 @@ constexpr auto operator+(const decimal_fast32_t lhs, const decimal_fast32_t rhs)
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) != signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init(detail::d32_fast_qnan, UINT8_C((0)));
         }
         
@@ -1043,6 +1052,11 @@ constexpr auto operator+(const decimal_fast32_t lhs, const Integer rhs) noexcept
     }
     #endif
 
+    if (detail::integer_sum_is_exact<decimal_fast32_t, Integer>(lhs.biased_exponent()))
+    {
+        return detail::add_integer_impl<decimal_fast32_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), rhs < 0);
+    }
+
     auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
 
     exp_type exp_rhs {0};
@@ -1069,6 +1083,7 @@ constexpr auto operator-(const decimal_fast32_t lhs, decimal_fast32_t rhs) noexc
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init(detail::d32_fast_qnan, UINT8_C((0)));
         }
         if (isinf(rhs) && !isnan(lhs))
@@ -1099,6 +1114,11 @@ constexpr auto operator-(const decimal_fast32_t lhs, const Integer rhs) noexcept
     }
     #endif
 
+    if (detail::integer_sum_is_exact<decimal_fast32_t, Integer>(lhs.biased_exponent()))
+    {
+        return detail::add_integer_impl<decimal_fast32_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), !(rhs < 0));
+    }
+
     auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
 
     exp_type exp_rhs {0};
@@ -1130,6 +1150,11 @@ constexpr auto operator-(const Integer lhs, const decimal_fast32_t rhs) noexcept
     }
     #endif
 
+    if (detail::integer_sum_is_exact<decimal_fast32_t, Integer>(rhs.biased_exponent()))
+    {
+        return detail::add_integer_impl<decimal_fast32_t>((-rhs).to_components(), detail::make_positive_unsigned(lhs), lhs < 0);
+    }
+
     auto sig_lhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(lhs))};
 
     exp_type exp_lhs {0};
@@ -1149,6 +1174,7 @@ constexpr auto operator*(const decimal_fast32_t lhs, const decimal_fast32_t rhs)
     {
         if ((isinf(lhs) && rhs == 0) || (isinf(rhs) && lhs == 0))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init(detail::d32_fast_qnan, UINT8_C(0));
         }
         else if (isinf(lhs) && !isnan(rhs) && (signbit(lhs) != signbit(rhs)))
@@ -1179,9 +1205,6 @@ template <typename Integer>
 constexpr auto operator*(const decimal_fast32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast32_t)
 {
-    using promoted_significand_type = detail::promote_significand_t<decimal_fast32_t, Integer>;
-    using exp_type = decimal_fast32_t::biased_exponent_type;
-
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (!isfinite(lhs))
     {
@@ -1198,16 +1221,7 @@ constexpr auto operator*(const decimal_fast32_t lhs, const Integer rhs) noexcept
     }
     #endif
 
-    auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
-    exp_type exp_rhs {0};
-    detail::normalize(sig_rhs, exp_rhs);
-
-    // We don't know if the original value of rhs fits into the decimal_fast32_t significand type
-    // but once it's normalized it's guaranteed to fit
-    const auto final_sig_rhs {static_cast<decimal_fast32_t::significand_type>(sig_rhs)};
-
-    return detail::mul_impl<decimal_fast32_t>(lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-                                             final_sig_rhs, exp_rhs, (rhs < 0));
+    return detail::mul_integer_impl<decimal_fast32_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), rhs < 0);
 }
 
 template <typename Integer>
@@ -1233,6 +1247,11 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
     {
         if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
         {
+            if (issignaling(lhs) || issignaling(rhs))
+            {
+                detail::raise_status(status_flags::fe_dec_invalid);
+            }
+
             // Operations on an SNAN return a QNAN with the same payload
             decimal_fast32_t return_nan {};
             if (lhs_fp == rhs_fp)
@@ -1270,6 +1289,7 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
             case FP_INFINITE:
                 if (rhs_fp == FP_INFINITE)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1282,6 +1302,7 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
             case FP_ZERO:
                 if (rhs_fp == FP_ZERO)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1298,6 +1319,7 @@ constexpr auto div_impl(const decimal_fast32_t lhs, const decimal_fast32_t rhs,
         switch (rhs_fp)
         {
             case FP_ZERO:
+                detail::raise_status(status_flags::fe_dec_divbyzero);
                 q = inf;
                 r = zero;
                 return;
@@ -1329,21 +1351,19 @@ template <typename Integer>
 constexpr auto operator/(const decimal_fast32_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast32_t)
 {
-    using exp_type = decimal_fast32_t::biased_exponent_type;
+    const bool sign {lhs.isneg() != (rhs < 0)};
 
     #ifndef BOOST_DECIMAL_FAST_MATH
     // Check pre-conditions
     constexpr decimal_fast32_t zero {0, 0};
     constexpr decimal_fast32_t inf {direct_init(detail::d32_fast_inf, UINT8_C(0), false)};
 
-    const bool sign {lhs.isneg() != (rhs < 0)};
-
     const auto lhs_fp {fpclassify(lhs)};
 
     switch (lhs_fp)
     {
         case FP_NAN:
-            return issignaling(lhs) ? nan_conversion(lhs) : lhs;
+            return detail::check_non_finite(lhs);
         case FP_INFINITE:
             return sign ? -lhs : lhs;
         case FP_ZERO:
@@ -1354,15 +1374,12 @@ constexpr auto operator/(const decimal_fast32_t lhs, const Integer rhs) noexcept
 
     if (rhs == 0)
     {
+        detail::raise_status(status_flags::fe_dec_divbyzero);
         return sign ? -inf : inf;
     }
     #endif
 
-    const detail::decimal_fast32_t_components lhs_components {lhs.significand_, lhs.biased_exponent(), lhs.sign_};
-    exp_type exp_rhs {};
-    const detail::decimal_fast32_t_components rhs_components {detail::shrink_significand<decimal_fast32_t::significand_type>(detail::make_positive_unsigned(rhs), exp_rhs), exp_rhs, rhs < 0};
-
-    return detail::generic_div_impl<decimal_fast32_t>(lhs_components, rhs_components);
+    return detail::div_integer_impl<decimal_fast32_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), sign);
 }
 
 template <typename Integer>
@@ -1383,10 +1400,11 @@ constexpr auto operator/(const Integer lhs, const decimal_fast32_t rhs) noexcept
     switch (rhs_fp)
     {
         case FP_NAN:
-            return issignaling(rhs) ? nan_conversion(rhs) : rhs;
+            return detail::check_non_finite(rhs);
         case FP_INFINITE:
             return sign ? -zero : zero;
         case FP_ZERO:
+            detail::raise_status(status_flags::fe_dec_divbyzero);
             return sign ? -inf : inf;
         default:
             static_cast<void>(lhs);
@@ -175,10 +175,13 @@ private:
     friend constexpr auto to_dpd_d64(DecimalType val) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, std::uint64_t);
 
-    template <typename ReturnType, typename T>
+    template <typename ReturnType, rounding_mode Mode, typename T>
     friend constexpr auto detail::add_impl(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
-    template <typename ReturnType, typename T>
+    template <typename ReturnType, rounding_mode Mode, typename T>
+    friend constexpr auto detail::add_same_exponent(const T& lhs, const T& rhs) noexcept -> ReturnType;
+
+    template <typename ReturnType, rounding_mode Mode, typename T>
     friend constexpr auto detail::d64_mul_impl(const T& lhs, const T& rhs) noexcept -> ReturnType;
 
     template <BOOST_DECIMAL_FAST_DECIMAL_FLOATING_TYPE DecimalType>
@@ -199,6 +202,9 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_scientific_impl(char* first, char* last, const TargetDecimalType& value, chars_format fmt) noexcept -> to_chars_result;
 
+    template <typename DecimalType>
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto detail::get_components(const DecimalType& val) noexcept -> detail::components_type<DecimalType>;
+
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetDecimalType>
     friend constexpr auto detail::to_chars_fixed_impl(char* first, char* last, const TargetDecimalType& value, const chars_format fmt) noexcept -> to_chars_result;
 
@@ -553,6 +559,7 @@ constexpr decimal_fast64_t::decimal_fast64_t(T1 coeff, T2 exp, const detail::con
 
     if (biased_exp > detail::max_biased_exp_v<decimal64_t>)
     {
+        detail::raise_status(status_flags::fe_dec_overflow | status_flags::fe_dec_inexact);
         significand_ = detail::d64_fast_inf;
     }
     else if (biased_exp >= 0)
@@ -562,6 +569,7 @@ constexpr decimal_fast64_t::decimal_fast64_t(T1 coeff, T2 exp, const detail::con
     else
     {
         // Flush denorms to zero, preserving sign per IEEE 754-2008 3.5.1
+        detail::raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
         significand_ = static_cast<significand_type>(0);
         exponent_ = static_cast<exponent_type>(0);
     }
@@ -1148,6 +1156,7 @@ constexpr auto operator+(const decimal_fast64_t lhs, const decimal_fast64_t rhs)
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) != signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init_d64(detail::d64_fast_qnan, 0, false);
         }
 
@@ -1172,6 +1181,11 @@ constexpr auto operator+(const decimal_fast64_t lhs, const Integer rhs) noexcept
     }
     #endif
 
+    if (detail::integer_sum_is_exact<decimal_fast64_t, Integer>(lhs.biased_exponent()))
+    {
+        return detail::add_integer_impl<decimal_fast64_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), rhs < 0);
+    }
+
     auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
 
     exp_type exp_rhs {0};
@@ -1198,6 +1212,7 @@ constexpr auto operator-(const decimal_fast64_t lhs, decimal_fast64_t rhs) noexc
     {
         if (isinf(lhs) && isinf(rhs) && signbit(lhs) == signbit(rhs))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init_d64(detail::d64_fast_qnan, 0, false);
         }
         if (isinf(rhs) && !isnan(lhs))
@@ -1228,6 +1243,11 @@ constexpr auto operator-(const decimal_fast64_t lhs, const Integer rhs) noexcept
     }
     #endif
 
+    if (detail::integer_sum_is_exact<decimal_fast64_t, Integer>(lhs.biased_exponent()))
+    {
+        return detail::add_integer_impl<decimal_fast64_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), !(rhs < 0));
+    }
+
     auto sig_rhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
 
     exp_type exp_rhs {0};
@@ -1259,6 +1279,11 @@ constexpr auto operator-(const Integer lhs, const decimal_fast64_t rhs) noexcept
     }
     #endif
 
+    if (detail::integer_sum_is_exact<decimal_fast64_t, Integer>(rhs.biased_exponent()))
+    {
+        return detail::add_integer_impl<decimal_fast64_t>((-rhs).to_components(), detail::make_positive_unsigned(lhs), lhs < 0);
+    }
+
     auto sig_lhs {static_cast<promoted_significand_type>(detail::make_positive_unsigned(lhs))};
 
     exp_type exp_lhs {0};
@@ -1278,6 +1303,7 @@ constexpr auto operator*(const decimal_fast64_t lhs, const decimal_fast64_t rhs)
     {
         if ((isinf(lhs) && rhs == 0) || (isinf(rhs) && lhs == 0))
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return direct_init_d64(detail::d64_fast_qnan, 0, false);
         }
         else if (isinf(lhs) && !isnan(rhs) && (signbit(lhs) != signbit(rhs)))
@@ -1308,9 +1334,6 @@ template <typename Integer>
 constexpr auto operator*(const decimal_fast64_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast64_t)
 {
-    using promoted_significand_type = detail::promote_significand_t<decimal64_t, Integer>;
-    using exp_type = decimal_fast64_t::biased_exponent_type;
-
     #ifndef BOOST_DECIMAL_FAST_MATH
     if (not_finite(lhs))
     {
@@ -1327,15 +1350,7 @@ constexpr auto operator*(const decimal_fast64_t lhs, const Integer rhs) noexcept
     }
     #endif
 
-    auto rhs_sig {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
-    exp_type rhs_exp {0};
-    detail::normalize<decimal64_t>(rhs_sig, rhs_exp);
-    auto final_rhs_sig {static_cast<decimal_fast64_t::significand_type>(rhs_sig)};
-
-    return detail::d64_mul_impl<decimal_fast64_t>(
-            lhs.significand_, lhs.biased_exponent(), lhs.sign_,
-            final_rhs_sig, rhs_exp, (rhs < 0)
-            );
+    return detail::mul_integer_impl<decimal_fast64_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), rhs < 0);
 }
 
 template <typename Integer>
@@ -1362,6 +1377,11 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
     {
         if (lhs_fp == FP_NAN || rhs_fp == FP_NAN)
         {
+            if (issignaling(lhs) || issignaling(rhs))
+            {
+                detail::raise_status(status_flags::fe_dec_invalid);
+            }
+
             // Operations on an SNAN return a QNAN with the same payload
             decimal_fast64_t return_nan {};
             if (lhs_fp == rhs_fp)
@@ -1399,6 +1419,7 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
             case FP_INFINITE:
                 if (rhs_fp == FP_INFINITE)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1411,6 +1432,7 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
             case FP_ZERO:
                 if (rhs_fp == FP_ZERO)
                 {
+                    detail::raise_status(status_flags::fe_dec_invalid);
                     q = nan;
                     r = nan;
                 }
@@ -1427,6 +1449,7 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
         switch (rhs_fp)
         {
             case FP_ZERO:
+                detail::raise_status(status_flags::fe_dec_divbyzero);
                 q = inf;
                 r = zero;
                 return;
@@ -1457,7 +1480,13 @@ constexpr auto d64_fast_div_impl(const decimal_fast64_t& lhs, const decimal_fast
     constexpr auto tens_needed {detail::pow10(static_cast<unsigned_int128_type>(offset))};
     const auto big_sig_lhs {static_cast<unsigned_int128_type>(lhs.significand_) * tens_needed};
 
-    const auto res_sig {big_sig_lhs / rhs.significand_};
+    // The last digit is made odd for an inexact quotient, as in d64_generic_div_impl
+    auto res_sig {big_sig_lhs / rhs.significand_};
+    if (res_sig * rhs.significand_ != big_sig_lhs)
+    {
+        res_sig |= 1U;
+    }
+
     const auto res_exp {(lhs.biased_exponent() - offset) - rhs.biased_exponent()};
 
     q = decimal_fast64_t{res_sig, res_exp, sign};
@@ -1477,9 +1506,6 @@ template <typename Integer>
 constexpr auto operator/(const decimal_fast64_t lhs, const Integer rhs) noexcept
     BOOST_DECIMAL_REQUIRES_RETURN(detail::is_integral_v, Integer, decimal_fast64_t)
 {
-    using promoted_significand_type = detail::promote_significand_t<decimal_fast64_t, Integer>;
-    using exp_type = detail::decimal_fast64_t_components::biased_exponent_type;
-
     const bool sign {lhs.isneg() != (rhs < 0)};
 
     #ifndef BOOST_DECIMAL_FAST_MATH
@@ -1492,7 +1518,7 @@ constexpr auto operator/(const decimal_fast64_t lhs, const Integer rhs) noexcept
     switch (lhs_fp)
     {
         case FP_NAN:
-            return issignaling(lhs) ? nan_conversion(lhs) : lhs;;
+            return detail::check_non_finite(lhs);
         case FP_INFINITE:
             return sign ? -lhs : lhs;
         case FP_ZERO:
@@ -1503,17 +1529,12 @@ constexpr auto operator/(const decimal_fast64_t lhs, const Integer rhs) noexcept
 
     if (rhs == 0)
     {
+        detail::raise_status(status_flags::fe_dec_divbyzero);
         return sign ? -inf : inf;
     }
     #endif
 
-    const detail::decimal_fast64_t_components lhs_components {lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()};
-
-    auto rhs_sig {static_cast<promoted_significand_type>(detail::make_positive_unsigned(rhs))};
-    exp_type rhs_exp {};
-    detail::decimal_fast64_t_components rhs_components {detail::shrink_significand<decimal_fast64_t::significand_type>(rhs_sig, rhs_exp), rhs_exp, rhs < 0};
-
-    return detail::d64_generic_div_impl<decimal_fast64_t>(lhs_components, rhs_components, sign);
+    return detail::div_integer_impl<decimal_fast64_t>(lhs.to_components(), detail::make_positive_unsigned(rhs), sign);
 }
 
 template <typename Integer>
@@ -1535,10 +1556,11 @@ constexpr auto operator/(const Integer lhs, const decimal_fast64_t rhs) noexcept
     switch (rhs_fp)
     {
         case FP_NAN:
-            return issignaling(rhs) ? nan_conversion(rhs) : rhs;
+            return detail::check_non_finite(rhs);
         case FP_INFINITE:
             return sign ? -zero : zero;
         case FP_ZERO:
+            detail::raise_status(status_flags::fe_dec_divbyzero);
             return sign ? -inf : inf;
         default:
             static_cast<void>(lhs);
@@ -0,0 +1,332 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DECIMAL_MULTIPLIER_HPP
+#define BOOST_DECIMAL_DECIMAL_MULTIPLIER_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/batch.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include <boost/decimal/detail/remove_trailing_zeros.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+#include <span>
+#endif
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The decoded rate along with the values derived from it that each multiplication would otherwise recompute
+template <typename DecimalType>
+struct multiplier_rate
+{
+    using significand_type = typename DecimalType::significand_type;
+
+    components_type<DecimalType> components {};
+
+    // Operands with a significand below this give a product that already fits in the precision,
+    // so it can be encoded without counting its digits or rounding
+    significand_type exact_limit {};
+
+    // A form of the rate significand that fits in 64 bits (if one exists) which gives
+    // the same result as the full significand, along with the matching exponent
+    std::uint64_t narrow_sig {};
+    std::int32_t narrow_exp {};
+    bool has_narrow_sig {};
+};
+
+template <typename DecimalType>
+constexpr auto make_exact_limit(const typename DecimalType::significand_type sig) noexcept -> typename DecimalType::significand_type
+{
+    using significand_type = typename DecimalType::significand_type;
+
+    const auto digits {num_digits(sig)};
+    return digits < precision_v<DecimalType> ? pow10(static_cast<significand_type>(precision_v<DecimalType> - digits)) : significand_type{1U};
+}
+
+template <typename DecimalType>
+constexpr auto make_multiplier_rate(const DecimalType rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value || std::is_same<DecimalType, decimal64_t>::value, multiplier_rate<DecimalType>>
+{
+    multiplier_rate<DecimalType> res {};
+    res.components = get_components(rate);
+    res.exact_limit = make_exact_limit<DecimalType>(res.components.sig);
+
+    return res;
+}
+
+template <typename DecimalType>
+constexpr auto make_multiplier_rate(const DecimalType rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value, multiplier_rate<DecimalType>>
+{
+    multiplier_rate<DecimalType> res {};
+    res.components = get_components(rate);
+    res.exact_limit = make_exact_limit<DecimalType>(res.components.sig);
+
+    // The cohort of the result depends on the rate's own, so the significand is used as is
+    if (res.components.sig.high == 0U)
+    {
+        res.narrow_sig = res.components.sig.low;
+        res.narrow_exp = res.components.exp;
+        res.has_narrow_sig = true;
+    }
+
+    return res;
+}
+
+// The fast types are always normalized, so the operands never fall below the exact limit
+template <typename DecimalType>
+constexpr auto make_multiplier_rate(const DecimalType rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast32_t>::value, multiplier_rate<DecimalType>>
+{
+    multiplier_rate<DecimalType> res {};
+    res.components = get_components(rate);
+
+    return res;
+}
+
+// The multiplication truncates the product by 13 digits before rounding.
+// When the rate ends in at least that many zeros the truncation is exact,
+// and can be folded into the rate itself.
+template <typename DecimalType>
+constexpr auto make_multiplier_rate(const DecimalType rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast64_t>::value, multiplier_rate<DecimalType>>
+{
+    constexpr auto ten_pow_13 {pow10(UINT64_C(13))};
+
+    multiplier_rate<DecimalType> res {};
+    res.components = get_components(rate);
+
+    if (res.components.sig % ten_pow_13 == 0U)
+    {
+        res.narrow_sig = res.components.sig / ten_pow_13;
+        res.narrow_exp = res.components.exp + 13;
+        res.has_narrow_sig = true;
+    }
+
+    return res;
+}
+
+// Rounding only depends on the digits of the product and the value of the result is normalized,
+// so trailing zeros can be moved from the rate significand into its exponent.
+// Most rates then fit in 64 bits.
+template <typename DecimalType>
+constexpr auto make_multiplier_rate(const DecimalType rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast128_t>::value, multiplier_rate<DecimalType>>
+{
+    multiplier_rate<DecimalType> res {};
+    res.components = get_components(rate);
+
+    if (res.components.sig != 0U)
+    {
+        const auto zeros {remove_trailing_zeros(res.components.sig)};
+        const auto sig {zeros.trimmed_number};
+
+        if (sig.high == 0U)
+        {
+            res.narrow_sig = sig.low;
+            res.narrow_exp = res.components.exp + static_cast<int>(zeros.number_of_removed_zeros);
+            res.has_narrow_sig = true;
+        }
+    }
+
+    return res;
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto multiplier_mul(const DecimalType val, const multiplier_rate<DecimalType>& rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value || std::is_same<DecimalType, decimal64_t>::value, DecimalType>
+{
+    using significand_type = typename DecimalType::significand_type;
+
+    const auto x {get_components(val)};
+
+    if (x.sig < rate.exact_limit)
+    {
+        return DecimalType{static_cast<significand_type>(x.sig * rate.components.sig),
+                           x.exp + rate.components.exp, x.sign != rate.components.sign};
+    }
+
+    return mul_impl<DecimalType>(x, rate.components);
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto multiplier_mul(const DecimalType val, const multiplier_rate<DecimalType>& rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value, DecimalType>
+{
+    const auto x {get_components(val)};
+    const bool sign {x.sign != rate.components.sign};
+
+    if (x.sig < rate.exact_limit)
+    {
+        return DecimalType{x.sig * rate.components.sig, x.exp + rate.components.exp, sign};
+    }
+
+    if (rate.has_narrow_sig)
+    {
+        return d128_round_product<DecimalType>(mul128By64(x.sig, rate.narrow_sig), x.exp + rate.narrow_exp, sign);
+    }
+
+    return d128_mul_impl<DecimalType>(x.sig, x.exp, x.sign,
+                                      rate.components.sig, rate.components.exp, rate.components.sign);
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto multiplier_mul(const DecimalType val, const multiplier_rate<DecimalType>& rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast32_t>::value, DecimalType>
+{
+    return mul_impl<DecimalType>(get_components(val), rate.components);
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto multiplier_mul(const DecimalType val, const multiplier_rate<DecimalType>& rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast64_t>::value, DecimalType>
+{
+    const auto x {get_components(val)};
+
+    if (rate.has_narrow_sig)
+    {
+        return DecimalType{x.sig * rate.narrow_sig, x.exp + rate.narrow_exp, x.sign != rate.components.sign};
+    }
+
+    return d64_mul_impl<DecimalType>(x, rate.components);
+}
+
+template <typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE constexpr auto multiplier_mul(const DecimalType val, const multiplier_rate<DecimalType>& rate) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast128_t>::value, DecimalType>
+{
+    const auto x {get_components(val)};
+
+    // Zero keeps the exponent of the product, so it can not use the rescaled rate
+    if (rate.has_narrow_sig && x.sig != 0U)
+    {
+        return d128_round_product<DecimalType>(mul128By64(x.sig, rate.narrow_sig),
+                                               x.exp + rate.narrow_exp, x.sign != rate.components.sign);
+    }
+
+    return d128_mul_impl<DecimalType>(x.sig, x.exp, x.sign,
+                                      rate.components.sig, rate.components.exp, rate.components.sign);
+}
+
+} // namespace detail
+
+// Multiplies values by a fixed rate.
+// The rate is decoded once on construction, along with everything that only depends on it,
+// which lowers the cost of each multiplication compared to operator*.
+// The results are identical to those of the scalar operator*.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+class decimal_multiplier
+{
+    static_assert(detail::is_decimal_floating_point_v<DecimalType>, "decimal_multiplier requires a decimal floating point type");
+
+public:
+    using value_type = DecimalType;
+
+private:
+    DecimalType rate_ {};
+    detail::multiplier_rate<DecimalType> data_ {};
+    bool rate_is_finite_ {};
+
+public:
+    explicit constexpr decimal_multiplier(const DecimalType rate) noexcept
+        : rate_ {rate}, data_ {detail::make_multiplier_rate(rate)}, rate_is_finite_ {isfinite(rate)} {}
+
+    constexpr auto rate() const noexcept -> DecimalType { return rate_; }
+
+    // Returns x * rate()
+    constexpr auto operator()(DecimalType x) const noexcept -> DecimalType;
+
+    // Computes out[i] = in[i] * rate() for i in [0, n)
+    // out may be the same array as in, but must not otherwise overlap it.
+    constexpr auto multiply(const DecimalType* in, DecimalType* out, std::size_t n) const noexcept -> void;
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    // The number of elements processed is the smaller of the two sizes
+    constexpr auto multiply(std::span<const DecimalType> in, std::span<DecimalType> out) const noexcept -> void;
+
+    #endif
+};
+
+template <typename DecimalType>
+constexpr auto decimal_multiplier<DecimalType>::operator()(const DecimalType x) const noexcept -> DecimalType
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!rate_is_finite_ || !isfinite(x))
+    {
+        return x * rate_;
+    }
+    #endif
+
+    return detail::multiplier_mul(x, data_);
+}
+
+template <typename DecimalType>
+constexpr auto decimal_multiplier<DecimalType>::multiply(const DecimalType* in, DecimalType* out, const std::size_t n) const noexcept -> void
+{
+    // A local copy keeps the cached rate in registers,
+    // since otherwise every store to out could alias it
+    const auto data {data_};
+
+    std::size_t i {};
+    while (i < n)
+    {
+        const auto block {n - i < detail::batch_block_size ? n - i : detail::batch_block_size};
+
+        if (BOOST_DECIMAL_UNLIKELY(!rate_is_finite_ || detail::batch_has_non_finite(in + i, block)))
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                out[j] = in[j] * rate_;
+            }
+        }
+        else
+        {
+            for (std::size_t j {i}; j < i + block; ++j)
+            {
+                out[j] = detail::multiplier_mul(in[j], data);
+            }
+        }
+
+        i += block;
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+constexpr auto decimal_multiplier<DecimalType>::multiply(std::span<const DecimalType> in, std::span<DecimalType> out) const noexcept -> void
+{
+    BOOST_DECIMAL_ASSERT(in.size() == out.size());
+
+    multiply(in.data(), out.data(), in.size() < out.size() ? in.size() : out.size());
+}
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DECIMAL_MULTIPLIER_HPP
@@ -13,6 +13,8 @@
 #include <boost/decimal/detail/promotion.hpp>
 #include <boost/decimal/detail/is_power_of_10.hpp>
 #include <boost/decimal/detail/i256.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/normalize.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -28,15 +30,66 @@ namespace detail {
 #  pragma warning(disable : 4127) // Conditional expression is constant
 #endif
 
-template <typename ReturnType, typename T>
+template <typename T>
+struct signed_sum_result
+{
+    T sig;
+    bool sign;
+};
+
+// The sum of two significands that share an exponent, as a magnitude and a sign.
+// Every path that adds operands with the same exponent goes through here, whether they are
+// decoded components or the fields of a BID word. T has to hold the sum of the two magnitudes.
+// Operands that cancel give a positive 0, and the callers apply the rules for the sign of zero.
+template <typename T>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto same_exponent_sum(const T& lhs_sig, const bool lhs_sign, const T& rhs_sig, const bool rhs_sign) noexcept
+    -> signed_sum_result<T>
+{
+    if (lhs_sign == rhs_sign)
+    {
+        return {static_cast<T>(lhs_sig + rhs_sig), lhs_sign};
+    }
+
+    if (lhs_sig > rhs_sig)
+    {
+        return {static_cast<T>(lhs_sig - rhs_sig), lhs_sign};
+    }
+    else if (rhs_sig > lhs_sig)
+    {
+        return {static_cast<T>(rhs_sig - lhs_sig), rhs_sign};
+    }
+
+    return {T{0}, false};
+}
+
+// When the exponents match no alignment is needed, and since both significands have at most
+// precision digits the magnitude of their sum has at most one more digit, which fits in an unsigned integer
+// of the width of the significand. A carry into that extra digit is rounded by the constructor of ReturnType.
+// Zeros take this path as well, with the same results as the zero handling of the general path.
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto add_same_exponent(const T& lhs, const T& rhs) noexcept -> ReturnType
+{
+    using add_type = std::conditional_t<decimal_val_v<T> < 128, std::uint64_t, int128::uint128_t>;
+
+    const auto sum {same_exponent_sum<add_type>(lhs.full_significand(), lhs.isneg(), rhs.full_significand(), rhs.isneg())};
+
+    // IEEE 754-2008 6.3: the sum of two -0s is -0
+    return make_rounded<ReturnType, Mode>(sum.sig, lhs.biased_exponent(), sum.sign || (lhs.isneg() && rhs.isneg()));
+}
+
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
 {
     // Each of the significands is maximally 23 bits.
     // Rather than doing division to get proper alignment we will promote to 64 bits
     // And do a single mul followed by an add
-    using add_type = std::conditional_t<decimal_val_v<T> < 64, std::int_fast64_t, int128::int128_t>;
     using promoted_sig_type = std::conditional_t<decimal_val_v<T> < 64, std::uint_fast64_t, int128::uint128_t>;
 
+    if (BOOST_DECIMAL_LIKELY(lhs.biased_exponent() == rhs.biased_exponent()))
+    {
+        return add_same_exponent<ReturnType, Mode>(lhs, rhs);
+    }
+
     promoted_sig_type big_lhs {lhs.full_significand()};
     promoted_sig_type big_rhs {rhs.full_significand()};
     auto lhs_exp {lhs.biased_exponent()};
@@ -53,15 +106,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
         // IEEE 754-2008 6.3: sum of opposite-sign zeros is +0 in default rounding.
         const auto result_exp {lhs_exp < rhs_exp ? lhs_exp : rhs_exp};
         const bool result_sign {lhs.isneg() && rhs.isneg()};
-        return ReturnType{lhs.full_significand(), result_exp, result_sign};
+        return make_rounded<ReturnType, Mode>(lhs.full_significand(), result_exp, result_sign);
     }
     if (big_lhs == 0U)
     {
-        return ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
+        return make_rounded<ReturnType, Mode>(rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
     }
     if (big_rhs == 0U)
     {
-        return ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()};
+        return make_rounded<ReturnType, Mode>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg());
     }
 
     // Align to larger exponent
@@ -72,16 +125,10 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
 
         if (shift > max_shift)
         {
-            auto round {_boost_decimal_global_rounding_mode};
-
-            #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
-
-            if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(lhs))
-            {
-                round = fegetround();
-            }
+            // Both operands are non-zero, so the smaller one is rounded away
+            raise_status(status_flags::fe_dec_inexact);
 
-            #endif
+            auto round {current_rounding_mode<Mode>()};
 
             // Resolve fe_dec_toward_zero into the equivalent directional mode
             // for the result's sign so the down/up paths below cover it too.
@@ -97,8 +144,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
             if (BOOST_DECIMAL_LIKELY(round != rounding_mode::fe_dec_downward && round != rounding_mode::fe_dec_upward))
             {
                 return big_lhs != 0U && (lhs_exp > rhs_exp) ?
-                                    ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()} :
-                                    ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
+                                    make_rounded<ReturnType, Mode>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()) :
+                                    make_rounded<ReturnType, Mode>(rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
             }
             else if (round == rounding_mode::fe_dec_downward)
             {
@@ -124,7 +171,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
                         }
                     }
 
-                    return ReturnType{big_lhs, lhs_exp, lhs.isneg()};
+                    return make_rounded<ReturnType, Mode>(big_lhs, lhs_exp, lhs.isneg());
                 }
                 else
                 {
@@ -143,7 +190,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
                         }
                     }
 
-                    return ReturnType{big_rhs, rhs_exp, rhs.isneg()};
+                    return make_rounded<ReturnType, Mode>(big_rhs, rhs_exp, rhs.isneg());
                 }
             }
             else
@@ -176,7 +223,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
                         }
                     }
 
-                    return ReturnType{big_lhs, lhs_exp, lhs.isneg()} ;
+                    return make_rounded<ReturnType, Mode>(big_lhs, lhs_exp, lhs.isneg()) ;
                 }
                 else
                 {
@@ -195,7 +242,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
                         }
                     }
 
-                    return ReturnType{big_rhs, rhs_exp, rhs.isneg()};
+                    return make_rounded<ReturnType, Mode>(big_rhs, rhs_exp, rhs.isneg());
                 }
             }
         }
@@ -212,21 +259,101 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto add_impl(const T& lhs, const T& rhs) noexcept
         }
     }
 
-    // Perform signed addition with overflow protection
-    const auto signed_lhs {detail::make_signed_value<add_type>(static_cast<add_type>(big_lhs), lhs.isneg())};
-    const auto signed_rhs {detail::make_signed_value<add_type>(static_cast<add_type>(big_rhs), rhs.isneg())};
+    // The aligned significands now share an exponent, and promoted_sig_type leaves room for the carry
+    const auto sum {same_exponent_sum<promoted_sig_type>(big_lhs, lhs.isneg(), big_rhs, rhs.isneg())};
+
+    return make_rounded<ReturnType, Mode>(sum.sig, lhs_exp, sum.sign);
+}
+
+// The sum of a decimal and an integer is computed exactly when the integer, used directly
+// as a significand with exponent 0, and the significand of the decimal can be aligned in one
+// word of the width selected below. The first digit of the wider word is kept free for the carry.
+template <typename ReturnType, typename Integer>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto integer_sum_is_exact(const int lhs_exp) noexcept -> bool
+{
+    using sum_type = std::conditional_t<decimal_val_v<ReturnType> < 64 && sizeof(Integer) <= sizeof(std::uint32_t), std::uint64_t, int128::uint128_t>;
+
+    constexpr auto sum_digits {std::numeric_limits<sum_type>::digits10 - 1};
+    constexpr auto integer_digits {std::numeric_limits<Integer>::digits10 + 1};
+
+    return sizeof(Integer) <= sizeof(std::uint64_t) &&
+           lhs_exp <= sum_digits - precision_v<ReturnType> &&
+           lhs_exp >= integer_digits - sum_digits;
+}
+
+// Adds the magnitude of an integer to a decimal with any number of digits, so neither
+// operand is normalized. The result is rounded once by the constructor of ReturnType.
+// The caller checks integer_sum_is_exact for the exponent of lhs.
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto add_integer_impl(const T& lhs, const Unsigned_Integer rhs_sig, const bool rhs_sign) noexcept -> ReturnType
+{
+    using sum_type = std::conditional_t<decimal_val_v<ReturnType> < 64 && sizeof(Unsigned_Integer) <= sizeof(std::uint32_t), std::uint64_t, int128::uint128_t>;
+
+    sum_type big_lhs {lhs.full_significand()};
+    sum_type big_rhs {rhs_sig};
+    auto res_exp {lhs.biased_exponent()};
+
+    if (res_exp > 0)
+    {
+        big_lhs *= pow10(static_cast<sum_type>(res_exp));
+        res_exp = 0;
+    }
+    else
+    {
+        big_rhs *= pow10(static_cast<sum_type>(-res_exp));
+    }
+
+    const auto sum {same_exponent_sum<sum_type>(big_lhs, lhs.isneg(), big_rhs, rhs_sign)};
+
+    // IEEE 754-2008 6.3: the sum of two -0s is -0
+    return make_rounded<ReturnType, Mode>(sum.sig, res_exp, sum.sign || (lhs.isneg() && rhs_sign));
+}
+
+// Adds two BID encoded words of decimal32_t or decimal64_t without decoding them.
+// When both operands use the small significand encoding (combination field other than 11)
+// with the same exponent, the sum has that exponent as well. As long as its significand
+// still fits the small encoding it is exact, and it is computed on the words directly.
+// Returns false and leaves result untouched in every other case, including cancellation to 0,
+// whose sign depends on the rounding mode.
+template <typename BitsType, BitsType significand_mask>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto bid_same_quantum_add(const BitsType lhs, const BitsType rhs, BitsType& result) noexcept -> bool
+{
+    constexpr auto sign_mask {static_cast<BitsType>(BitsType{1} << (sizeof(BitsType) * 8U - 1U))};
+    constexpr auto comb_11_mask {static_cast<BitsType>(BitsType{3} << (sizeof(BitsType) * 8U - 3U))};
+    constexpr auto exp_mask {static_cast<BitsType>(~(sign_mask | significand_mask))};
 
-    const auto new_sig {signed_lhs + signed_rhs};
-    const auto return_sig {detail::make_positive_unsigned(new_sig)};
+    // Equal exponent fields also have equal combination fields, so only lhs needs to be checked
+    if (((lhs ^ rhs) & exp_mask) != 0U || (lhs & comb_11_mask) == comb_11_mask)
+    {
+        return false;
+    }
 
-    return ReturnType{return_sig, lhs_exp, new_sig < 0};
+    const auto lhs_sign {(lhs & sign_mask) != 0U};
+    const auto sum {same_exponent_sum<BitsType>(static_cast<BitsType>(lhs & significand_mask), lhs_sign,
+                                                static_cast<BitsType>(rhs & significand_mask), (rhs & sign_mask) != 0U)};
+
+    // One compare rejects both a sum of 0 and one that needs the large significand encoding
+    if (static_cast<BitsType>(sum.sig - 1U) >= significand_mask)
+    {
+        return false;
+    }
+
+    // The operand with the sign of the sum already holds the sign and exponent fields of the result
+    result = static_cast<BitsType>(((sum.sign == lhs_sign ? lhs : rhs) & ~significand_mask) | sum.sig);
+    return true;
 }
 
-template <typename ReturnType, typename T>
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs) noexcept -> ReturnType
 {
     using promoted_sig_type = u256;
 
+    // The sum of two 34 digit significands fits in 128 bits
+    if (BOOST_DECIMAL_LIKELY(lhs.biased_exponent() == rhs.biased_exponent()))
+    {
+        return add_same_exponent<ReturnType, Mode>(lhs, rhs);
+    }
+
     auto big_lhs {lhs.full_significand()};
     auto big_rhs {rhs.full_significand()};
     auto lhs_exp {lhs.biased_exponent()};
@@ -244,15 +371,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
         // IEEE 754-2008 6.3: sum of opposite-sign zeros is +0 in default rounding.
         const auto result_exp {lhs_exp < rhs_exp ? lhs_exp : rhs_exp};
         const bool result_sign {lhs.isneg() && rhs.isneg()};
-        return ReturnType{lhs.full_significand(), result_exp, result_sign};
+        return make_rounded<ReturnType, Mode>(lhs.full_significand(), result_exp, result_sign);
     }
     if (big_lhs == typename T::significand_type{0})
     {
-        return ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
+        return make_rounded<ReturnType, Mode>(rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
     }
     if (big_rhs == typename T::significand_type{0})
     {
-        return ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()};
+        return make_rounded<ReturnType, Mode>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg());
     }
 
     // Align to larger exponent
@@ -263,16 +390,10 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
 
         if (shift > max_shift)
         {
-            auto round {_boost_decimal_global_rounding_mode};
+            // Both operands are non-zero, so the smaller one is rounded away
+            raise_status(status_flags::fe_dec_inexact);
 
-            #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
-
-            if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(lhs))
-            {
-                round = fegetround();
-            }
-
-            #endif
+            auto round {current_rounding_mode<Mode>()};
 
             // Resolve fe_dec_toward_zero into the equivalent directional mode
             // for the result's sign so the down/up paths below cover it too.
@@ -288,8 +409,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
             if (BOOST_DECIMAL_LIKELY(round != rounding_mode::fe_dec_downward && round != rounding_mode::fe_dec_upward))
             {
                 return big_lhs != 0U && (lhs_exp > rhs_exp) ?
-                                    ReturnType{lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()} :
-                                    ReturnType{rhs.full_significand(), rhs.biased_exponent(), rhs.isneg()};
+                                    make_rounded<ReturnType, Mode>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg()) :
+                                    make_rounded<ReturnType, Mode>(rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
             }
             else if (round == rounding_mode::fe_dec_downward)
             {
@@ -315,7 +436,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
                         }
                     }
 
-                    return ReturnType{big_lhs, lhs_exp, lhs.isneg()};
+                    return make_rounded<ReturnType, Mode>(big_lhs, lhs_exp, lhs.isneg());
                 }
                 else
                 {
@@ -334,7 +455,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
                         }
                     }
 
-                    return ReturnType{big_rhs, rhs_exp, rhs.isneg()};
+                    return make_rounded<ReturnType, Mode>(big_rhs, rhs_exp, rhs.isneg());
                 }
             }
             else
@@ -367,7 +488,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
                         }
                     }
 
-                    return ReturnType{big_lhs, lhs_exp, lhs.isneg()} ;
+                    return make_rounded<ReturnType, Mode>(big_lhs, lhs_exp, lhs.isneg()) ;
                 }
                 else
                 {
@@ -386,7 +507,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
                         }
                     }
 
-                    return ReturnType{big_rhs, rhs_exp, rhs.isneg()};
+                    return make_rounded<ReturnType, Mode>(big_rhs, rhs_exp, rhs.isneg());
                 }
             }
         }
@@ -433,11 +554,57 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_new(const T& lhs, const T& rhs)
         // and we can just convert to 128-bit arithmetic now
         if (return_sig[2] == 0U && return_sig[3] == 0U)
         {
-            return ReturnType{static_cast<int128::uint128_t>(return_sig), lhs_exp, return_sign};
+            return make_rounded<ReturnType, Mode>(static_cast<int128::uint128_t>(return_sig), lhs_exp, return_sign);
+        }
+    }
+
+    return make_rounded<ReturnType, Mode>(return_sig, lhs_exp, return_sign);
+}
+
+// decimal128_t does not normalize its significands, and they commonly have far fewer than 34 digits.
+// When both are non-zero and their aligned values fit in 18 digits, the exact sum is computed in 64-bit integers.
+// It is then given the same representation that d128_add_impl_new would produce from the expanded significands:
+// that result is aligned to the smaller expanded exponent, and has its excess trailing zeros removed by the constructor.
+// All other cases are expanded to full precision and passed on to d128_add_impl_new.
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_add_impl_narrow(T lhs, T rhs) noexcept -> ReturnType
+{
+    constexpr int narrow_digits {std::numeric_limits<std::int64_t>::digits10 - 1};
+    constexpr auto target_precision {detail::precision_v<ReturnType>};
+
+    if ((lhs.sig.high | rhs.sig.high) == 0U && lhs.sig.low != 0U && rhs.sig.low != 0U)
+    {
+        // The exponents of the leading digits
+        const auto lhs_top {lhs.exp + num_digits(lhs.sig.low)};
+        const auto rhs_top {rhs.exp + num_digits(rhs.sig.low)};
+        const auto max_top {lhs_top > rhs_top ? lhs_top : rhs_top};
+        const auto min_exp {lhs.exp < rhs.exp ? lhs.exp : rhs.exp};
+
+        if (BOOST_DECIMAL_LIKELY(max_top - min_exp <= narrow_digits))
+        {
+            const auto big_lhs {lhs.sig.low * pow10(static_cast<std::uint64_t>(lhs.exp - min_exp))};
+            const auto big_rhs {rhs.sig.low * pow10(static_cast<std::uint64_t>(rhs.exp - min_exp))};
+
+            const auto sum {same_exponent_sum<std::uint64_t>(big_lhs, lhs.sign, big_rhs, rhs.sign)};
+
+            // The expanded significands are aligned to min_top - target_precision,
+            // and a sum with more than target_precision digits loses its trailing zeros
+            const auto min_top {lhs_top < rhs_top ? lhs_top : rhs_top};
+            auto zeros {min_exp - (min_top - target_precision)};
+            const auto sum_digits {num_digits(sum.sig)};
+            if (sum_digits + zeros > target_precision)
+            {
+                zeros = target_precision - sum_digits;
+            }
+
+            return make_rounded<ReturnType, Mode>(int128::uint128_t{sum.sig} * pow10(static_cast<int128::uint128_t>(zeros)), min_exp - zeros, sum.sign);
         }
     }
 
-    return ReturnType{return_sig, lhs_exp, return_sign};
+    expand_significand<ReturnType>(lhs.sig, lhs.exp);
+    expand_significand<ReturnType>(rhs.sig, rhs.exp);
+
+    return d128_add_impl_new<ReturnType, Mode>(lhs, rhs);
 }
 
 #ifdef _MSC_VER
@@ -7,6 +7,7 @@
 
 #include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <type_traits>
@@ -33,6 +34,11 @@ BOOST_DECIMAL_CUDA_CONSTEXPR Decimal check_non_finite(Decimal lhs, Decimal rhs)
         const bool lhs_signaling {issignaling(lhs)};
         const bool rhs_signaling {issignaling(rhs)};
 
+        if (lhs_signaling || rhs_signaling)
+        {
+            raise_status(status_flags::fe_dec_invalid);
+        }
+
         if (!lhs_signaling && rhs_signaling)
         {
             return nan_conversion(rhs);
@@ -43,7 +49,13 @@ BOOST_DECIMAL_CUDA_CONSTEXPR Decimal check_non_finite(Decimal lhs, Decimal rhs)
     }
     else if (isnan(rhs))
     {
-        return issignaling(rhs) ? nan_conversion(rhs) : rhs;
+        if (issignaling(rhs))
+        {
+            raise_status(status_flags::fe_dec_invalid);
+            return nan_conversion(rhs);
+        }
+
+        return rhs;
     }
 
     if (isinf(lhs))
@@ -64,7 +76,13 @@ BOOST_DECIMAL_CUDA_CONSTEXPR Decimal check_non_finite(Decimal x) noexcept
 
     if (isnan(x))
     {
-        return issignaling(x) ? nan_conversion(x) : x;
+        if (issignaling(x))
+        {
+            raise_status(status_flags::fe_dec_invalid);
+            return nan_conversion(x);
+        }
+
+        return x;
     }
 
     BOOST_DECIMAL_ASSERT(isinf(x));
@@ -11,6 +11,7 @@
 #include <boost/decimal/decimal128_t.hpp>
 #include <boost/decimal/decimal_fast128_t.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/components.hpp>
 
 namespace boost {
 namespace decimal {
@@ -22,14 +23,6 @@ namespace detail {
 #pragma warning(disable : 4127)
 #endif
 
-template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec>
-using components_type = std::conditional_t<std::is_same<Dec, decimal32_t>::value, decimal32_t_components,
-                        std::conditional_t<std::is_same<Dec, decimal_fast32_t>::value, decimal_fast32_t_components,
-                        std::conditional_t<std::is_same<Dec, decimal64_t>::value, decimal64_t_components,
-                        std::conditional_t<std::is_same<Dec, decimal_fast64_t>::value, decimal_fast64_t_components,
-                        std::conditional_t<std::is_same<Dec, decimal128_t>::value, decimal128_t_components, decimal_fast128_t_components
-                        >>>>>;
-
 template <bool checked, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
 constexpr auto d32_fma_impl(T x, T y, T z) noexcept -> T
 {
@@ -221,11 +221,11 @@ constexpr auto read_payload(const T value) noexcept
     }
     else if (issignaling(value))
     {
-        return value.significand_ ^ detail::get_snan_mask<T>();
+        return value.full_significand() & ~detail::get_snan_mask<T>();
     }
     else
     {
-        return value.significand_ ^ detail::get_qnan_mask<T>();
+        return value.full_significand() & ~detail::get_qnan_mask<T>();
     }
 }
 
@@ -155,18 +155,23 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto fast_equality_impl(const DecimalType&
     }
     #endif
 
-    const auto lhs_sig {lhs.significand_};
-    const auto rhs_sig {rhs.significand_};
-
-    if (lhs_sig == 0U && rhs_sig == 0U)
+    const auto lhs_sig {lhs.full_significand()};
+    const auto rhs_sig {rhs.full_significand()};
+
+    if (lhs_sig == 0U && rhs_sig == 0U
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        // Infinities have no significand bits in the compact layout of decimal_fast128_t
+        && isfinite(lhs) && isfinite(rhs)
+        #endif
+        )
     {
         // -0 == +0
         return true;
     }
 
     return  lhs_sig == rhs_sig &&
-            lhs.exponent_ == rhs.exponent_ &&
-            lhs.sign_ == rhs.sign_;
+            lhs.unbiased_exponent() == rhs.unbiased_exponent() &&
+            lhs.isneg() == rhs.isneg();
 }
 
 template <BOOST_DECIMAL_FAST_DECIMAL_FLOATING_TYPE DecimalType>
@@ -404,31 +409,39 @@ BOOST_DECIMAL_FORCE_INLINE constexpr auto fast_less_impl(const DecimalType& lhs,
     }
     #endif
 
+    const auto lhs_sig {lhs.full_significand()};
+    const auto rhs_sig {rhs.full_significand()};
+    const auto lhs_sign {lhs.isneg()};
+    const auto rhs_sign {rhs.isneg()};
+
     // Needed to correctly compare signed and unsigned zeros
-    if (lhs.significand_ == 0U || rhs.significand_ == 0U)
+    if (lhs_sig == 0U || rhs_sig == 0U)
     {
-        if (lhs.significand_ == 0U && rhs.significand_ == 0U)
+        if (lhs_sig == 0U && rhs_sig == 0U)
         {
             #ifndef BOOST_DECIMAL_FAST_MATH
-            return lhs.sign_ && !rhs.sign_;
+            return lhs_sign && !rhs_sign;
             #else
             return false;
             #endif
         }
-        return lhs.significand_ == 0U ? !rhs.sign_ : lhs.sign_;
+        return lhs_sig == 0U ? !rhs_sign : lhs_sign;
     }
 
-    if (lhs.sign_ != rhs.sign_)
+    if (lhs_sign != rhs_sign)
     {
-        return lhs.sign_;
+        return lhs_sign;
     }
 
-    if (lhs.exponent_ != rhs.exponent_)
+    const auto lhs_exp {lhs.unbiased_exponent()};
+    const auto rhs_exp {rhs.unbiased_exponent()};
+
+    if (lhs_exp != rhs_exp)
     {
-        return lhs.sign_ ? lhs.exponent_ > rhs.exponent_ : lhs.exponent_ < rhs.exponent_;
+        return lhs_sign ? lhs_exp > rhs_exp : lhs_exp < rhs_exp;
     }
 
-    return lhs.sign_ ? lhs.significand_ > rhs.significand_ : lhs.significand_ < rhs.significand_;
+    return lhs_sign ? lhs_sig > rhs_sig : lhs_sig < rhs_sig;
 }
 
 template <BOOST_DECIMAL_INTEGRAL T, BOOST_DECIMAL_INTEGRAL U>
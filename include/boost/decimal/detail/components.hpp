@@ -5,11 +5,13 @@
 #ifndef BOOST_DECIMAL_DETAIL_COMPONENTS_HPP
 #define BOOST_DECIMAL_DETAIL_COMPONENTS_HPP
 
+#include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cstdint>
+#include <type_traits>
 #endif
 
 namespace boost {
@@ -81,6 +83,22 @@ using decimal128_t_components = impl::decimal_components<boost::int128::uint128_
 
 using decimal_fast128_t_components = impl::decimal_components<boost::int128::uint128_t, std::int32_t>;
 
+template <typename Dec>
+using components_type = std::conditional_t<std::is_same<Dec, decimal32_t>::value, decimal32_t_components,
+                        std::conditional_t<std::is_same<Dec, decimal_fast32_t>::value, decimal_fast32_t_components,
+                        std::conditional_t<std::is_same<Dec, decimal64_t>::value, decimal64_t_components,
+                        std::conditional_t<std::is_same<Dec, decimal_fast64_t>::value, decimal_fast64_t_components,
+                        std::conditional_t<std::is_same<Dec, decimal128_t>::value, decimal128_t_components, decimal_fast128_t_components
+                        >>>>>;
+
+// Allows the algorithms built on top of the types to work with the decoded representation
+// without each of them having to be a friend of every type
+template <typename DecimalType>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto get_components(const DecimalType& val) noexcept -> components_type<DecimalType>
+{
+    return val.to_components();
+}
+
 #ifdef __GNUC__
 #  pragma GCC diagnostic pop
 #endif
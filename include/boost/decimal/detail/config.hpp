@@ -321,6 +321,14 @@ typedef unsigned __int128 builtin_uint128_t;
 #  define BOOST_DECIMAL_INLINE_VARIABLE static
 #endif
 
+// The runtime rounding mode is kept per thread.
+// Platforms without thread local storage can define BOOST_DECIMAL_NO_THREAD_LOCAL to share one between all threads.
+#ifndef BOOST_DECIMAL_NO_THREAD_LOCAL
+#  define BOOST_DECIMAL_THREAD_LOCAL thread_local
+#else
+#  define BOOST_DECIMAL_THREAD_LOCAL
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 #  define BOOST_DECIMAL_UNREACHABLE __builtin_unreachable()
 #elif defined(_MSC_VER)
@@ -337,6 +345,15 @@ typedef unsigned __int128 builtin_uint128_t;
 #  define BOOST_DECIMAL_FORCE_INLINE inline
 #endif
 
+// Keeps rarely taken paths out of the loops that call them
+#if defined(_MSC_VER)
+#  define BOOST_DECIMAL_NO_INLINE __declspec(noinline)
+#elif defined(__GNUC__) || defined(__clang__)
+#  define BOOST_DECIMAL_NO_INLINE __attribute__ ((__noinline__))
+#else
+#  define BOOST_DECIMAL_NO_INLINE
+#endif
+
 #ifdef __FAST_MATH__
 #  define BOOST_DECIMAL_FAST_MATH
 #endif
@@ -364,6 +381,18 @@ typedef unsigned __int128 builtin_uint128_t;
 
 #endif
 
+// Only the feature test macro is needed here, and the headers with std::span overloads include <span> themselves
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#  if __has_include(<version>)
+#    ifndef BOOST_DECIMAL_BUILD_MODULE
+#      include <version>
+#    endif
+#    if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#      define BOOST_DECIMAL_HAS_STD_SPAN
+#    endif
+#  endif
+#endif
+
 // Since we should not be able to pull these in from the STL in module mode define them ourselves
 // This is also low risk since they are not supposed to be exported
 #ifdef BOOST_DECIMAL_BUILD_MODULE
@@ -6,6 +6,9 @@
 #define BOOST_DECIMAL_DETAIL_DIV_IMPL_HPP
 
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include <boost/decimal/detail/normalize.hpp>
 #include <boost/decimal/detail/u256.hpp>
 #include "int128.hpp"
 
@@ -18,14 +21,16 @@ namespace boost {
 namespace decimal {
 namespace detail {
 
-template <typename DecimalType, typename T>
+template <typename DecimalType, rounding_mode Mode = runtime_rounding_mode, typename T>
 BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto generic_div_impl(const T& lhs, const T& rhs) noexcept -> DecimalType
 {
     // If rhs is greater than we need to offset the significands to get the correct values
     // e.g. 4/8 is 0 but 40/8 yields 5 in integer maths
     //
     // By expanding the offset to all the way to the value of numeric_limits<std::uint64_t>::digits10
-    // we can recover more of what would become the fraction to achieve better rounding
+    // we can recover more of what would become the fraction to achieve better rounding.
+    // lhs has precision digits, so the quotient has at least precision + 2 digits,
+    // and as in div_integer_impl its last digit is made odd when the division is inexact.
 
     using div_type = std::uint64_t;
 
@@ -34,32 +39,131 @@ BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto generic_div_impl(co
 
     const auto big_sig_lhs {lhs.full_significand() * ten_pow_offset};
 
-    const auto res_sig {big_sig_lhs / rhs.full_significand()};
+    auto res_sig {big_sig_lhs / rhs.full_significand()};
     const auto res_exp {(lhs.biased_exponent() - precision_offset) - rhs.biased_exponent()};
 
+    if (res_sig * rhs.full_significand() != big_sig_lhs)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+
+        res_sig |= 1U;
+    }
+
     // IEEE 754-2008: division uses sign(x) XOR sign(y) for all results, including zero
     const bool sign {lhs.isneg() != rhs.isneg()};
 
     // Let the constructor handle shrinking it back down and rounding correctly
-    return DecimalType{res_sig, res_exp, sign};
+    return make_rounded<DecimalType, Mode>(res_sig, res_exp, sign);
 }
 
-template <typename DecimalType, typename T>
+template <typename DecimalType, rounding_mode Mode = runtime_rounding_mode, typename T>
 BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_generic_div_impl(const T& lhs, const T& rhs, const bool sign) noexcept -> DecimalType
 {
     using unsigned_int128_type = boost::int128::uint128_t;
 
     // If rhs is greater than we need to offset the significands to get the correct values
-    // e.g. 4/8 is 0 but 40/8 yields 5 in integer maths
+    // e.g. 4/8 is 0 but 40/8 yields 5 in integer maths.
+    // As in generic_div_impl the quotient keeps at least two digits past the precision for the sticky digit.
     constexpr auto offset {std::numeric_limits<unsigned_int128_type>::digits10 - detail::precision_v<decimal64_t>};
     constexpr auto tens_needed {detail::pow10(static_cast<unsigned_int128_type>(offset))};
     const auto big_sig_lhs {static_cast<unsigned_int128_type>(lhs.sig) * tens_needed};
 
-    const auto res_sig {big_sig_lhs / rhs.sig};
+    auto res_sig {big_sig_lhs / rhs.sig};
     const auto res_exp {(lhs.exp - offset) - rhs.exp};
 
+    if (res_sig * rhs.sig != big_sig_lhs)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+
+        res_sig |= 1U;
+    }
+
     // Let the constructor handle shrinking it back down and rounding correctly
-    return DecimalType{res_sig, res_exp, sign};
+    return make_rounded<DecimalType, Mode>(res_sig, res_exp, sign);
+}
+
+// The magnitude of an integer of up to 64 bits is used directly as the divisor with exponent 0.
+// lhs must have precision digits: offsetting it to the width of div_type then leaves at least
+// precision + 2 digits in the quotient, whose last digit is made odd when the division is inexact
+// so that the constructor rounds the quotient correctly.
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer,
+          std::enable_if_t<(sizeof(Unsigned_Integer) <= sizeof(std::uint64_t)), bool> = true>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_integer_impl(const T& lhs, const Unsigned_Integer rhs_sig, const bool sign) noexcept -> ReturnType
+{
+    using div_type = std::conditional_t<decimal_val_v<ReturnType> < 64 && sizeof(Unsigned_Integer) <= sizeof(std::uint32_t), std::uint64_t, int128::uint128_t>;
+
+    constexpr auto offset {std::numeric_limits<div_type>::digits10 - detail::precision_v<ReturnType>};
+    constexpr auto ten_pow_offset {detail::pow10(static_cast<div_type>(offset))};
+
+    const auto big_sig_lhs {div_type{lhs.full_significand()} * ten_pow_offset};
+    auto res_sig {big_sig_lhs / rhs_sig};
+
+    if (res_sig * rhs_sig != big_sig_lhs)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+
+        if (res_sig % 2U == 0U)
+        {
+            ++res_sig;
+        }
+    }
+
+    return make_rounded<ReturnType, Mode>(res_sig, lhs.biased_exponent() - offset, sign);
+}
+
+// 128-bit integers can have more digits than the dividend leaves room for, so they are rounded to the precision of ReturnType first
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer,
+          std::enable_if_t<(sizeof(Unsigned_Integer) > sizeof(std::uint64_t)), bool> = true>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto div_integer_impl(const T& lhs, Unsigned_Integer rhs_sig, const bool sign) noexcept -> ReturnType
+{
+    std::int32_t rhs_exp {};
+    normalize<ReturnType>(rhs_sig, rhs_exp);
+
+    const T lhs_components {lhs.full_significand(), lhs.biased_exponent() - rhs_exp, lhs.isneg()};
+    return div_integer_impl<ReturnType, Mode>(lhs_components, static_cast<std::uint64_t>(rhs_sig), sign);
+}
+
+// As div_integer_impl for the 128-bit types: lhs has 34 digits, so offsetting it by 38 digits
+// leaves at least 36 digits in the quotient of a 64-bit divisor
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer,
+          std::enable_if_t<(sizeof(Unsigned_Integer) <= sizeof(std::uint64_t)), bool> = true>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_div_integer_impl(const T& lhs, const Unsigned_Integer rhs_sig, const bool sign) noexcept -> ReturnType
+{
+    constexpr auto offset {std::numeric_limits<int128::uint128_t>::digits10};
+    constexpr auto ten_pow_offset {detail::pow10(static_cast<int128::uint128_t>(offset))};
+
+    const auto res {impl::div_mod(detail::umul256(lhs.full_significand(), ten_pow_offset), std::uint64_t{rhs_sig})};
+    auto res_sig {res.quotient};
+
+    if (res.remainder != u256{})
+    {
+        raise_status(status_flags::fe_dec_inexact);
+
+        res_sig[0] |= 1U;
+    }
+
+    return d128_round_product<ReturnType, Mode>(res_sig, lhs.biased_exponent() - offset, sign);
+}
+
+// A divisor of up to 39 digits needs another 4 digits of offset, which is still less than 77 digits in total
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer,
+          std::enable_if_t<(sizeof(Unsigned_Integer) > sizeof(std::uint64_t)), bool> = true>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_div_integer_impl(const T& lhs, const Unsigned_Integer rhs_sig, const bool sign) noexcept -> ReturnType
+{
+    constexpr auto offset {std::numeric_limits<int128::uint128_t>::digits10 + 4};
+    constexpr auto ten_pow_offset {detail::pow10(static_cast<int128::uint128_t>(std::numeric_limits<int128::uint128_t>::digits10))};
+
+    const auto res {impl::div_mod(detail::umul256(lhs.full_significand(), ten_pow_offset) * UINT64_C(10000), static_cast<int128::uint128_t>(rhs_sig))};
+    auto res_sig {res.quotient};
+
+    if (res.remainder != u256{})
+    {
+        raise_status(status_flags::fe_dec_inexact);
+
+        res_sig[0] |= 1U;
+    }
+
+    return d128_round_product<ReturnType, Mode>(res_sig, lhs.biased_exponent() - offset, sign);
 }
 
 template <typename T>
@@ -73,11 +177,27 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_generic_div_impl(const T& lhs, const T& r
     auto res_sig {big_sig_lhs / rhs.sig};
     auto res_exp {lhs.exp - rhs.exp - detail::precision_v<decimal128_t>};
 
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+    if (big_sig_lhs % rhs.sig != u256{})
+    {
+        raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
+
     if (res_sig[3] != 0 || res_sig[2] != 0)
     {
         const auto sig_dig {detail::num_digits(res_sig)};
         const auto digit_delta {sig_dig - std::numeric_limits<int128::uint128_t>::digits10};
-        res_sig /= pow10(int128::uint128_t(digit_delta));
+        const auto shift_pow_ten {pow10(int128::uint128_t(digit_delta))};
+
+        #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+        if (res_sig % shift_pow_ten != u256{})
+        {
+            raise_status(status_flags::fe_dec_inexact);
+        }
+        #endif
+
+        res_sig /= shift_pow_ten;
         res_exp += digit_delta;
     }
     // IEEE 754-2008: division uses sign(x) XOR sign(y) for all results, including zero,
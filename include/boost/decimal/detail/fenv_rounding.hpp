@@ -11,6 +11,7 @@
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/power_tables.hpp>
 #include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/invariant_div.hpp>
 #include <boost/decimal/detail/int128/cstdlib.hpp>
 #include <boost/decimal/detail/utilities.hpp>
 
@@ -85,10 +86,12 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto divmod10(const T dividend) noexcept -> divmod1
     return {q, static_cast<std::uint64_t>(r)};
 }
 
-BOOST_DECIMAL_CUDA_CONSTEXPR auto divmod10(const u256& lhs) noexcept
+// Multiplies by the reciprocal of 10 instead of dividing,
+// and the remainder is found from the low word alone since it is less than 10
+BOOST_DECIMAL_CUDA_CONSTEXPR auto divmod10(const u256& lhs) noexcept -> divmod10_result<u256>
 {
-    constexpr int128::uint128_t ten {10U};
-    return div_mod(lhs, ten);
+    const auto q {div_pow10(lhs, 1)};
+    return {q, lhs[0] - q[0] * 10U};
 }
 
 BOOST_DECIMAL_CUDA_CONSTEXPR auto divmod10(const int128::uint128_t lhs) noexcept -> divmod10_result<int128::uint128_t>
@@ -100,6 +103,30 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto divmod10(const int128::uint128_t lhs) noexcept
     return {q, r.low};
 }
 
+// Divides by pow_ten = 10^k
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto divmod_pow10(const T& dividend, const int k, const T& pow_ten) noexcept -> divmod_result<T>
+{
+    const auto q {div_pow10(dividend, k)};
+    return {q, static_cast<T>(dividend - q * pow_ten)};
+}
+
+#if defined(BOOST_DECIMAL_DETAIL_INT128_HAS_INT128) && !(defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA))
+
+// The builtin division by a one word divisor gives the remainder along with the quotient
+constexpr auto divmod_pow10(const int128::uint128_t& dividend, const int k, const int128::uint128_t& pow_ten) noexcept -> divmod_result<int128::uint128_t>
+{
+    if (k <= std::numeric_limits<std::uint64_t>::digits10)
+    {
+        return divmod(dividend, pow_ten);
+    }
+
+    const auto q {div_pow10(dividend, k)};
+    return {q, dividend - q * pow_ten};
+}
+
+#endif
+
 template <typename TargetType, typename T>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto fenv_round_impl(T& val, const bool is_neg, const bool sticky, const rounding_mode round) noexcept -> int
 {
@@ -161,34 +188,75 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto fenv_round_impl(T& val, const bool is_neg, con
 
 }
 
+// Selects the current rounding mode of the calling thread when used as the Mode parameter of the functions below.
+// Any other value is a rounding mode fixed at compile time, which lets the dispatch on the mode fold away.
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE rounding_mode runtime_rounding_mode {static_cast<rounding_mode>(0U)};
+
 #ifdef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
 
-template <typename TargetType, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
-BOOST_DECIMAL_CUDA_CONSTEXPR auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noexcept -> int
+template <rounding_mode Mode = runtime_rounding_mode>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto current_rounding_mode() noexcept -> rounding_mode
 {
-    constexpr auto round {_boost_decimal_global_rounding_mode};
-    return impl::fenv_round_impl<TargetType>(val, is_neg, sticky, round);
+    return Mode == runtime_rounding_mode ? _boost_decimal_global_rounding_mode : Mode;
 }
 
 #else
 
-template <typename TargetType, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
-BOOST_DECIMAL_CUDA_CONSTEXPR auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noexcept -> int // NOLINT(readability-function-cognitive-complexity)
+template <rounding_mode Mode = runtime_rounding_mode>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto current_rounding_mode() noexcept -> rounding_mode
 {
-    if (BOOST_DECIMAL_IS_CONSTANT_EVALUATED(coeff))
+    BOOST_DECIMAL_IF_CONSTEXPR (Mode != runtime_rounding_mode)
+    {
+        return Mode;
+    }
+
+    if (BOOST_DECIMAL_IS_CONSTANT_EVALUATED(Mode))
     {
-        constexpr auto round {_boost_decimal_global_rounding_mode};
-        return impl::fenv_round_impl<TargetType>(val, is_neg, sticky, round);
+        return _boost_decimal_global_rounding_mode;
     }
     else
     {
-        const auto round {fegetround()};
-        return impl::fenv_round_impl<TargetType>(val, is_neg, sticky, round);
+        return fegetround();
     }
 }
 
 #endif
 
+// Raises the status flags of the calling thread if BOOST_DECIMAL_ENABLE_STATUS_FLAGS is defined, and otherwise does nothing.
+// Nothing is raised during constant evaluation.
+//
+// Callers always call it without a guard of their own. A test that is only made to decide whether to raise the flags,
+// and that the result does not otherwise need, goes inside #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS so that it costs nothing.
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto raise_status(BOOST_DECIMAL_ATTRIBUTE_UNUSED const status_flags flags) noexcept -> void
+{
+    #if defined(BOOST_DECIMAL_ENABLE_STATUS_FLAGS) && !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION)
+    if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(flags))
+    {
+        feraiseexcept(flags);
+    }
+    #endif
+}
+
+// Raises inexact, along with underflow for a tiny result, if rounding val with fenv_round discards non-zero digits
+template <typename T>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto raise_rounding_status(BOOST_DECIMAL_ATTRIBUTE_UNUSED const T& val,
+                                                                                   BOOST_DECIMAL_ATTRIBUTE_UNUSED const bool sticky,
+                                                                                   BOOST_DECIMAL_ATTRIBUTE_UNUSED const bool tiny) noexcept -> void
+{
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+    if (sticky || impl::divmod10(val).remainder != 0U)
+    {
+        raise_status(tiny ? status_flags::fe_dec_underflow | status_flags::fe_dec_inexact : status_flags::fe_dec_inexact);
+    }
+    #endif
+}
+
+template <typename TargetType, rounding_mode Mode = runtime_rounding_mode, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto fenv_round(T& val, bool is_neg = false, bool sticky = false) noexcept -> int
+{
+    return impl::fenv_round_impl<TargetType>(val, is_neg, sticky, current_rounding_mode<Mode>());
+}
+
 #ifdef _MSC_VER
 #  pragma warning(push)
 #  pragma warning(disable : 4127)
@@ -197,7 +265,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto fenv_round(T& val, bool is_neg = false, bool s
 #  pragma GCC diagnostic ignored "-Wsign-conversion"
 #endif
 
-template <typename TargetDecimalType, typename T1, typename T2, typename T3>
+template <typename TargetDecimalType, rounding_mode Mode = runtime_rounding_mode, typename T1, typename T2, typename T3>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto coefficient_rounding(T1& coeff, T2& exp, T3& biased_exp, const bool sign, int coeff_digits) noexcept
 {
     // T1 will be a 128-bit or 256-bit
@@ -219,9 +287,17 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto coefficient_rounding(T1& coeff, T2& exp, T3& b
         shift = (boost::decimal::detail::max)(shift_for_small_exp, shift_for_large_coeff);
     }
 
+    // IEEE 754 section 7.5: a result is tiny when its exponent is below that of the smallest normal value before rounding
+    const bool tiny {!is_fast_type_v<TargetDecimalType> && biased_exp + coeff_digits < detail::precision_v<TargetDecimalType>};
+
     if (BOOST_DECIMAL_UNLIKELY(shift > std::numeric_limits<T1>::digits10))
     {
         // Bounds check for our tables in pow10
+        if (coeff != 0U)
+        {
+            raise_status(status_flags::fe_dec_underflow | status_flags::fe_dec_inexact);
+        }
+
         coeff = 0;
         return 1;
     }
@@ -243,17 +319,18 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto coefficient_rounding(T1& coeff, T2& exp, T3& b
     }
     else
     {
-        if (coeff < std::numeric_limits<demoted_integer_type>::max())
+        // The power of ten must also fit in the demoted type
+        if (coeff < std::numeric_limits<demoted_integer_type>::max() && shift <= std::numeric_limits<demoted_integer_type>::digits10)
         {
             const auto smaller_coeff {static_cast<demoted_integer_type>(coeff)};
-            const auto div_res {impl::divmod(smaller_coeff, static_cast<demoted_integer_type>(shift_pow_ten))};
+            const auto div_res {impl::divmod_pow10(smaller_coeff, shift, static_cast<demoted_integer_type>(shift_pow_ten))};
             shifted_coeff = static_cast<demoted_integer_type>(div_res.quotient);
             const auto trailing_digits {div_res.remainder};
             sticky = trailing_digits != 0U;
         }
         else
         {
-            const auto div_res {impl::divmod(coeff, shift_pow_ten)};
+            const auto div_res {impl::divmod_pow10(coeff, shift, shift_pow_ten)};
             shifted_coeff = static_cast<demoted_integer_type>(div_res.quotient);
             const auto trailing_digits {div_res.remainder};
             sticky = trailing_digits != 0U;
@@ -261,7 +338,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto coefficient_rounding(T1& coeff, T2& exp, T3& b
     }
 
     // Do rounding
-    const auto removed_digits {detail::fenv_round<TargetDecimalType>(shifted_coeff, sign, sticky)};
+    raise_rounding_status(shifted_coeff, sticky, tiny);
+    const auto removed_digits {detail::fenv_round<TargetDecimalType, Mode>(shifted_coeff, sign, sticky)};
     coeff = static_cast<T1>(shifted_coeff);
 
     const auto offset {removed_digits + shift};
@@ -272,6 +350,33 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto coefficient_rounding(T1& coeff, T2& exp, T3& b
     return coeff_digits;
 }
 
+// Constructs ReturnType{coeff, exp, sign}, rounding in Mode rather than in the current rounding mode.
+// The coefficient is rounded to the precision of ReturnType here, so the constructor only has to encode it.
+// For subnormal results of the IEEE types the shift also brings the exponent up to the smallest one,
+// so the current rounding mode is never consulted, even during constant evaluation.
+template <typename ReturnType, rounding_mode Mode, typename T1, typename T2, std::enable_if_t<Mode == runtime_rounding_mode, bool> = true>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto make_rounded(T1 coeff, T2 exp, const bool sign) noexcept -> ReturnType
+{
+    return ReturnType{coeff, exp, sign};
+}
+
+template <typename ReturnType, rounding_mode Mode, typename T1, typename T2, std::enable_if_t<Mode != runtime_rounding_mode, bool> = true>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto make_rounded(T1 coeff, T2 exp, const bool sign) noexcept -> ReturnType
+{
+    using sig_type = typename ReturnType::significand_type;
+    constexpr auto max_sig {static_cast<sig_type>(impl::max_significand_v<ReturnType>())};
+
+    auto biased_exp {static_cast<int>(exp) + bias_v<ReturnType>};
+
+    // The fast types flush subnormals to zero without rounding
+    if (coeff > max_sig || (!is_fast_type_v<ReturnType> && BOOST_DECIMAL_UNLIKELY(biased_exp < 0)))
+    {
+        coefficient_rounding<ReturnType, Mode>(coeff, exp, biased_exp, sign, num_digits(coeff));
+    }
+
+    return ReturnType{coeff, exp, sign};
+}
+
 #ifdef _MSC_VER
 #  pragma warning(pop)
 #elif defined(__GNUC__)
@@ -23,6 +23,34 @@ namespace boost {
 namespace decimal {
 namespace detail {
 
+namespace impl {
+
+// A value of bit width b lies in [2^(b-1), 2^b - 1], so it has either the number of digits of 2^b - 1,
+// which is floor(b * log10(2)) + 1, or one fewer. 1233 / 4096 gives the exact floor for every b in [1, 256],
+// leaving a single compare against the smallest power of ten with that many digits.
+//
+// Callers count the digits of x | 1 instead of x: setting the low bit never carries up to a power of ten
+// and it gives 0 a bit width of 1 so that it has one digit.
+BOOST_DECIMAL_CUDA_CONSTEXPR auto max_digits_of_bit_width(const int bits) noexcept -> int
+{
+    return ((bits * 1233) >> 12) + 1;
+}
+
+// lhs < rhs as the borrow out of lhs - rhs, which does not depend on which word first differs
+BOOST_DECIMAL_CUDA_CONSTEXPR auto borrows(const u256& lhs, const u256& rhs) noexcept -> bool
+{
+    std::uint64_t borrow {};
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        const auto diff {lhs[i] - rhs[i]};
+        borrow = static_cast<std::uint64_t>(lhs[i] < rhs[i]) | static_cast<std::uint64_t>(diff < borrow);
+    }
+
+    return borrow != 0U;
+}
+
+} // namespace impl
+
 // Generic solution
 template <typename T, std::enable_if_t<std::numeric_limits<T>::digits10 <= std::numeric_limits<std::uint32_t>::digits10, bool> = true>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto num_digits(T init_x) noexcept -> int
@@ -37,43 +65,18 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto num_digits(T init_x) noexcept -> int
 
     #endif
 
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
-
-    const auto x {static_cast<std::uint32_t>(init_x)};
-
-    const auto msb {32 - int128::detail::impl::countl_impl(x)};
-
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+    const auto x {static_cast<std::uint32_t>(init_x) | 1U};
+    const auto digits {impl::max_digits_of_bit_width(32 - int128::detail::impl::countl_impl(x))};
 
     #if defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA)
 
-    if (estimated_digits < 10 && x >= powers_of_10_u32[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
-
-    if (estimated_digits > 1 && x < powers_of_10_u32[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    return digits - static_cast<int>(x < powers_of_10_u32[digits - 1]);
 
     #else
 
-    if (estimated_digits < 10 && x >= impl::powers_of_10_u32[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
-
-    if (estimated_digits > 1 && x < impl::powers_of_10_u32[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    return digits - static_cast<int>(x < impl::powers_of_10_u32[digits - 1]);
 
     #endif
-
-    return estimated_digits;
 }
 
 template <typename T, std::enable_if_t<(std::numeric_limits<T>::digits10 <= std::numeric_limits<std::uint64_t>::digits10) &&
@@ -93,43 +96,18 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto num_digits(T init_x) noexcept -> int
 
     #endif
 
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
-
-    const auto x {static_cast<std::uint64_t>(init_x)};
-
-    const auto msb {63 - int128::detail::impl::countl_impl(x)};
-
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+    const auto x {static_cast<std::uint64_t>(init_x) | 1U};
+    const auto digits {impl::max_digits_of_bit_width(64 - int128::detail::impl::countl_impl(x))};
 
     #if defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA)
 
-    if (estimated_digits < 20 && x >= powers_of_10[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
-
-    if (estimated_digits > 1 && x < powers_of_10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    return digits - static_cast<int>(x < powers_of_10[digits - 1]);
 
     #else
 
-    if (estimated_digits < 20 && x >= impl::powers_of_10[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
-
-    if (estimated_digits > 1 && x < impl::powers_of_10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    return digits - static_cast<int>(x < impl::powers_of_10[digits - 1]);
 
     #endif
-
-    return estimated_digits;
 }
 
 #ifdef _MSC_VER
@@ -137,13 +115,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto num_digits(T init_x) noexcept -> int
 # pragma warning(disable: 4307) // MSVC 14.1 warns of intergral constant overflow
 #endif
 
-BOOST_DECIMAL_CUDA_CONSTEXPR int num_digits(const int128::uint128_t& x) noexcept
+BOOST_DECIMAL_CUDA_CONSTEXPR int num_digits(const int128::uint128_t& init_x) noexcept
 {
-    if (x.high == UINT64_C(0))
-    {
-        return num_digits(x.low);
-    }
-
     #if defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA)
 
     constexpr boost::int128::uint128_t BOOST_DECIMAL_DETAIL_INT128_pow10[39] =
@@ -191,80 +164,41 @@ BOOST_DECIMAL_CUDA_CONSTEXPR int num_digits(const int128::uint128_t& x) noexcept
 
     #endif
 
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
+    const int128::uint128_t x {init_x.high, init_x.low | 1U};
 
-    const auto msb {64 + (63 - int128::detail::impl::countl_impl(x.high))};
+    // The zeros of the low word only count when the high word is all zeros, which is applied as a multiplier
+    // so that there is nothing to branch on. Counting in high | 1 keeps the count well-defined without a zero check,
+    // and the one zero that it misses is added back along with the low word.
+    const auto zeros {int128::detail::impl::countl_impl(x.high | 1U) +
+                      static_cast<int>(x.high == 0U) * (int128::detail::impl::countl_impl(x.low) + 1)};
 
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
+    const auto digits {impl::max_digits_of_bit_width(128 - zeros)};
 
     #if defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA)
 
-    if (estimated_digits < 39 && x >= BOOST_DECIMAL_DETAIL_INT128_pow10[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
-
-    // Estimated digits can't be less than 20 (65-bits)
-    if (x < BOOST_DECIMAL_DETAIL_INT128_pow10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    return digits - static_cast<int>(x < BOOST_DECIMAL_DETAIL_INT128_pow10[digits - 1]);
 
     #else
 
-    if (estimated_digits < 39 && x >= impl::BOOST_DECIMAL_DETAIL_INT128_pow10[estimated_digits])
-    {
-        return estimated_digits + 1;
-    }
-
-    // Estimated digits can't be less than 20 (65-bits)
-    if (x < impl::BOOST_DECIMAL_DETAIL_INT128_pow10[estimated_digits - 1])
-    {
-        return estimated_digits - 1;
-    }
+    return digits - static_cast<int>(x < impl::BOOST_DECIMAL_DETAIL_INT128_pow10[digits - 1]);
 
     #endif
-
-    return estimated_digits;
 }
 
-BOOST_DECIMAL_CUDA_CONSTEXPR int num_digits(const u256& x) noexcept
+BOOST_DECIMAL_CUDA_CONSTEXPR int num_digits(const u256& init_x) noexcept
 {
-    if ((x[3] | x[2]) == 0)
-    {
-        return num_digits(int128::uint128_t{x[1], x[0]});
-    }
+    const u256 x {init_x[3], init_x[2], init_x[1], init_x[0] | 1U};
 
-    // Use the most significant bit position to approximate log10
-    // log10(x) ~= log2(x) / log2(10) ~= log2(x) / 3.32
-
-    int msb {};
-    if (x[3] != 0U)
+    // As with uint128_t, each word's zeros only count when every word above it is all zeros
+    auto zeros {int128::detail::impl::countl_impl(x[0])};
+    for (std::size_t i {1U}; i < 4U; ++i)
     {
-        msb = 192 + (63 - int128::detail::impl::countl_impl(x[3]));
+        zeros = int128::detail::impl::countl_impl(x[i] | 1U) + static_cast<int>(x[i] == 0U) * (zeros + 1);
     }
-    else
-    {
-        msb = 128 + (63 - int128::detail::impl::countl_impl(x[2]));
-    }
-
-    // Approximate log10
-    const auto estimated_digits {(msb * 1000) / 3322 + 1}; // 1000/3322 ~= 1/log2(10)
 
-    if (estimated_digits < 78 && x >= pow10_256(estimated_digits))
-    {
-        return estimated_digits + 1;
-    }
-
-    // Estimated digits will never be less than 39 (129 bits)
-    if (x < pow10_256(estimated_digits - 1))
-    {
-        return estimated_digits - 1;
-    }
+    const auto digits {impl::max_digits_of_bit_width(256 - zeros)};
 
-    return estimated_digits;
+    return digits - static_cast<int>(impl::borrows(x, pow10_256(static_cast<std::size_t>(digits - 1))));
 }
 
 #ifdef _MSC_VER
@@ -0,0 +1,260 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_INVARIANT_DIV_HPP
+#define BOOST_DECIMAL_DETAIL_INVARIANT_DIV_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include "int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#endif
+
+// Division by an integer that is known ahead of time, following
+// N. Möller and T. Granlund, "Improved division by invariant integers", IEEE Transactions on Computers, 2011.
+//
+// The divisor is normalized so that its most significant bit is set, and an approximation of its reciprocal is computed once.
+// Each division is then a handful of multiplications, and a correction step that is almost never taken,
+// in place of a hardware divide per 64-bit word (or the long division of u256).
+// The quotients are exact, so they can be used anywhere the truncating division would be.
+// The division steps and reciprocals (Algorithms 4 and 5) are shared with the long division in u256.hpp.
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+namespace impl {
+
+// The bits that are moved out of the top of word when it is shifted left by shift in [0, 63]
+BOOST_DECIMAL_FORCE_INLINE constexpr auto shifted_out(const std::uint64_t word, const int shift) noexcept -> std::uint64_t
+{
+    return (word >> 1U) >> (63 - shift);
+}
+
+} // namespace impl
+
+// A divisor of up to 128 bits in normalized form along with its reciprocal
+struct invariant_divisor
+{
+    int128::uint128_t d {};     // Normalized divisor, only d.high is used when the divisor fits in one word
+    std::uint64_t v {};         // Reciprocal
+    int shift {};               // Number of bits the divisor was shifted left to normalize it
+    bool is_wide {};            // The divisor needs more than 64 bits
+
+    constexpr invariant_divisor() noexcept = default;
+
+    // From the already normalized parts, as in the tables below
+    constexpr invariant_divisor(const int128::uint128_t& normalized, const std::uint64_t reciprocal,
+                                const int normalizing_shift, const bool wide) noexcept
+        : d {normalized}, v {reciprocal}, shift {normalizing_shift}, is_wide {wide} {}
+
+    // divisor must not be zero
+    explicit BOOST_DECIMAL_CUDA_CONSTEXPR invariant_divisor(const int128::uint128_t& divisor) noexcept
+    {
+        BOOST_DECIMAL_ASSERT(divisor != 0U);
+
+        is_wide = divisor.high != 0U;
+
+        if (is_wide)
+        {
+            shift = int128::detail::impl::countl_impl(divisor.high);
+            d = divisor << shift;
+
+            v = impl::reciprocal_3by2(d.high, d.low);
+        }
+        else
+        {
+            shift = int128::detail::impl::countl_impl(divisor.low);
+            d = int128::uint128_t{divisor.low << shift, 0U};
+
+            v = impl::reciprocal_2by1(d.high);
+        }
+    }
+};
+
+// Returns n / div for a divisor that fits in one word
+BOOST_DECIMAL_FORCE_INLINE constexpr auto invariant_div(const std::uint64_t n, const invariant_divisor& div) noexcept -> std::uint64_t
+{
+    BOOST_DECIMAL_ASSERT(!div.is_wide);
+
+    std::uint64_t r {};
+    return impl::div_2by1(impl::shifted_out(n, div.shift), n << div.shift, div.d.high, div.v, r);
+}
+
+// Returns n / div
+BOOST_DECIMAL_FORCE_INLINE constexpr auto invariant_div(const int128::uint128_t& n, const invariant_divisor& div) noexcept -> int128::uint128_t
+{
+    const auto s {div.shift};
+
+    if (div.is_wide)
+    {
+        // The quotient fits in one word, and the top two words of the shifted dividend are less than d
+        int128::uint128_t r {};
+        return int128::uint128_t{impl::div_3by2(impl::shifted_out(n.high, s), (n.high << s) | impl::shifted_out(n.low, s), n.low << s,
+                                                div.d, div.v, r)};
+    }
+
+    std::uint64_t r {};
+    const auto q1 {impl::div_2by1(impl::shifted_out(n.high, s), (n.high << s) | impl::shifted_out(n.low, s), div.d.high, div.v, r)};
+    const auto q0 {impl::div_2by1(r, n.low << s, div.d.high, div.v, r)};
+
+    return {q1, q0};
+}
+
+// Returns n / div
+BOOST_DECIMAL_FORCE_INLINE constexpr auto invariant_div(const u256& n, const invariant_divisor& div) noexcept -> u256
+{
+    const auto s {div.shift};
+
+    // The dividend shifted by the same amount as the divisor, which does not change the quotient
+    const std::uint64_t u4 {impl::shifted_out(n[3], s)};
+    const std::uint64_t u3 {(n[3] << s) | impl::shifted_out(n[2], s)};
+    const std::uint64_t u2 {(n[2] << s) | impl::shifted_out(n[1], s)};
+    const std::uint64_t u1 {(n[1] << s) | impl::shifted_out(n[0], s)};
+    const std::uint64_t u0 {n[0] << s};
+
+    if (!div.is_wide)
+    {
+        std::uint64_t r {};
+        const auto q3 {impl::div_2by1(u4, u3, div.d.high, div.v, r)};
+        const auto q2 {impl::div_2by1(r, u2, div.d.high, div.v, r)};
+        const auto q1 {impl::div_2by1(r, u1, div.d.high, div.v, r)};
+        const auto q0 {impl::div_2by1(r, u0, div.d.high, div.v, r)};
+
+        return {q3, q2, q1, q0};
+    }
+
+    // The top word of the quotient is only non-zero for dividends of more than 192 + shift bits
+    int128::uint128_t r {u4, u3};
+    std::uint64_t q3 {};
+    if (r >= div.d)
+    {
+        q3 = impl::div_3by2(UINT64_C(0), u4, u3, div.d, div.v, r);
+    }
+
+    const auto q2 {impl::div_3by2(r.high, r.low, u2, div.d, div.v, r)};
+    const auto q1 {impl::div_3by2(r.high, r.low, u1, div.d, div.v, r)};
+    const auto q0 {impl::div_3by2(r.high, r.low, u0, div.d, div.v, r)};
+
+    return {q3, q2, q1, q0};
+}
+
+#if !defined(__CUDACC__) || !defined(BOOST_DECIMAL_ENABLE_CUDA)
+
+namespace impl {
+
+// invariant_divisor{10^k} for k in [0, 38], so that rounding by a power of ten needs no division at all
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE invariant_divisor pow10_divisors[39] =
+{
+    invariant_divisor{int128::uint128_t{UINT64_C(0x8000000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0xFFFFFFFFFFFFFFFF), 63, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xA000000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x9999999999999999), 60, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xC800000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x47AE147AE147AE14), 57, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xFA00000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x0624DD2F1A9FBE76), 54, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x9C40000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0xA36E2EB1C432CA57), 50, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xC350000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x4F8B588E368F0846), 47, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xF424000000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x0C6F7A0B5ED8D36B), 44, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x9896800000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0xAD7F29ABCAF48578), 40, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xBEBC200000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x5798EE2308C39DF9), 37, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xEE6B280000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x12E0BE826D694B2E), 34, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x9502F90000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0xB7CDFD9D7BDBAB7D), 30, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xBA43B74000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x5FD7FE17964955FD), 27, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xE8D4A51000000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x19799812DEA11197), 24, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x9184E72A00000000), UINT64_C(0x0000000000000000)}, UINT64_C(0xC25C268497681C26), 20, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xB5E620F480000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x6849B86A12B9B01E), 17, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xE35FA931A0000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x203AF9EE756159B2), 14, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x8E1BC9BF04000000), UINT64_C(0x0000000000000000)}, UINT64_C(0xCD2B297D889BC2B6), 10, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xB1A2BC2EC5000000), UINT64_C(0x0000000000000000)}, UINT64_C(0x70EF54646D496892), 7, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xDE0B6B3A76400000), UINT64_C(0x0000000000000000)}, UINT64_C(0x2725DD1D243ABA0E), 4, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x8AC7230489E80000), UINT64_C(0x0000000000000000)}, UINT64_C(0xD83C94FB6D2AC34A), 0, false},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xAD78EBC5AC620000), UINT64_C(0x0000000000000000)}, UINT64_C(0x79CA10C9242235D5), 61, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xD8D726B7177A8000), UINT64_C(0x0000000000000000)}, UINT64_C(0x2E3B40A0E9B4F7DD), 58, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x878678326EAC9000), UINT64_C(0x0000000000000000)}, UINT64_C(0xE392010175EE5962), 54, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xA968163F0A57B400), UINT64_C(0x0000000000000000)}, UINT64_C(0x82DB34012B25144E), 51, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xD3C21BCECCEDA100), UINT64_C(0x0000000000000000)}, UINT64_C(0x357C299A88EA76A5), 48, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x84595161401484A0), UINT64_C(0x0000000000000000)}, UINT64_C(0xEF2D0F5DA7DD8AA2), 44, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xA56FA5B99019A5C8), UINT64_C(0x0000000000000000)}, UINT64_C(0x8C240C4AECB13BB5), 41, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xCECB8F27F4200F3A), UINT64_C(0x0000000000000000)}, UINT64_C(0x3CE9A36F23C0FC90), 38, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x813F3978F8940984), UINT64_C(0x4000000000000000)}, UINT64_C(0xFB0F6BE50601941B), 34, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xA18F07D736B90BE5), UINT64_C(0x5000000000000000)}, UINT64_C(0x95A5EFEA6B34767C), 31, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xC9F2C9CD04674EDE), UINT64_C(0xA400000000000000)}, UINT64_C(0x4484BFEEBC29F863), 28, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xFC6F7C4045812296), UINT64_C(0x4D00000000000000)}, UINT64_C(0x039D66589687F9E9), 25, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x9DC5ADA82B70B59D), UINT64_C(0xF020000000000000)}, UINT64_C(0x9F623D5A8A732974), 21, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xC5371912364CE305), UINT64_C(0x6C28000000000000)}, UINT64_C(0x4C4E977BA1F5BAC3), 18, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xF684DF56C3E01BC6), UINT64_C(0xC732000000000000)}, UINT64_C(0x09D8792FB4C49569), 15, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x9A130B963A6C115C), UINT64_C(0x3C7F400000000000)}, UINT64_C(0xA95A5B7F87A0EF0F), 11, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xC097CE7BC90715B3), UINT64_C(0x4B9F100000000000)}, UINT64_C(0x54484932D2E725A5), 8, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0xF0BDC21ABB48DB20), UINT64_C(0x1E86D40000000000)}, UINT64_C(0x1039D428A8B8EAEA), 5, true},
+    invariant_divisor{int128::uint128_t{UINT64_C(0x96769950B50D88F4), UINT64_C(0x1314448000000000)}, UINT64_C(0xB38FB9DAA78E44AB), 1, true},
+};
+
+} // namespace impl
+
+#endif // !defined(__CUDACC__) || !defined(BOOST_DECIMAL_ENABLE_CUDA)
+
+// Returns n / 10^k
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto div_pow10(const T n, const int k) noexcept -> T
+{
+    return static_cast<T>(n / pow10(static_cast<T>(k)));
+}
+
+// Returns n / 10^k for k in [0, 38]
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_pow10(const int128::uint128_t& n, const int k) noexcept -> int128::uint128_t
+{
+    BOOST_DECIMAL_ASSERT(k >= 0 && k <= 38);
+
+    #if defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA)
+
+    return n / pow10(static_cast<int128::uint128_t>(k));
+
+    #else
+
+    #ifdef BOOST_DECIMAL_DETAIL_INT128_HAS_INT128
+    // With a native 128-bit type a one word divisor takes at most two hardware divisions,
+    // which measured faster than the reciprocal. Wider divisors take the slow path of the builtin division.
+    if (k <= std::numeric_limits<std::uint64_t>::digits10)
+    {
+        return n / pow10(static_cast<int128::uint128_t>(k));
+    }
+    #endif
+
+    return invariant_div(n, impl::pow10_divisors[k]);
+
+    #endif
+}
+
+// Returns n / 10^k for k in [0, 78], the range of pow10 for u256
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_pow10(const u256& n, int k) noexcept -> u256
+{
+    BOOST_DECIMAL_ASSERT(k >= 0 && k <= 78);
+
+    #if defined(__CUDACC__) && defined(BOOST_DECIMAL_ENABLE_CUDA)
+
+    return n / pow10(static_cast<u256>(k));
+
+    #else
+
+    // 10^k no longer fits in 128 bits past k = 38, but floor(floor(n / a) / b) == floor(n / (a * b)),
+    // which also gives the zero quotient of k = 78 where 10^k does not fit in 256 bits either
+    auto q {n};
+    while (k > 38)
+    {
+        q = invariant_div(q, impl::pow10_divisors[38]);
+        k -= 38;
+    }
+
+    return invariant_div(q, impl::pow10_divisors[k]);
+
+    #endif
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_INVARIANT_DIV_HPP
@@ -10,6 +10,11 @@
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/promotion.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/normalize.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include <boost/decimal/detail/cmath/isfinite.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <type_traits>
@@ -18,6 +23,97 @@
 namespace boost {
 namespace decimal {
 
+namespace detail {
+
+// Decodes a finite value straight into the components of the promoted type,
+// so the narrower operand is never encoded as a value of the promoted type first
+template <typename PromotedType, typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto promote_components(const DecimalType val) noexcept -> components_type<PromotedType>
+{
+    return static_cast<components_type<PromotedType>>(get_components(val));
+}
+
+// Addition expects the significands expanded to the precision of the promoted type,
+// except for decimal128_t which expands them itself after checking for a narrow fast path
+template <typename PromotedType, typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto promote_add_components(const DecimalType val) noexcept
+    -> std::enable_if_t<std::is_same<PromotedType, decimal128_t>::value, components_type<PromotedType>>
+{
+    return promote_components<PromotedType>(val);
+}
+
+template <typename PromotedType, typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto promote_add_components(const DecimalType val) noexcept
+    -> std::enable_if_t<!std::is_same<PromotedType, decimal128_t>::value, components_type<PromotedType>>
+{
+    auto components {promote_components<PromotedType>(val)};
+    expand_significand<PromotedType>(components.sig, components.exp);
+    return components;
+}
+
+// Multiplication rounds the full product, so only decimal_fast64_t which truncates it needs expanded significands
+template <typename PromotedType, typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto promote_mul_components(const DecimalType val) noexcept
+    -> std::enable_if_t<std::is_same<PromotedType, decimal_fast64_t>::value, components_type<PromotedType>>
+{
+    auto components {promote_components<PromotedType>(val)};
+    expand_significand<PromotedType>(components.sig, components.exp);
+    return components;
+}
+
+template <typename PromotedType, typename DecimalType>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto promote_mul_components(const DecimalType val) noexcept
+    -> std::enable_if_t<!std::is_same<PromotedType, decimal_fast64_t>::value, components_type<PromotedType>>
+{
+    return promote_components<PromotedType>(val);
+}
+
+// Each type runs the same implementation as its own operators on the promoted components
+
+template <typename PromotedType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mixed_add_impl(const T& lhs, const T& rhs) noexcept
+    -> std::enable_if_t<decimal_val_v<PromotedType> < 128, PromotedType>
+{
+    return add_impl<PromotedType>(lhs, rhs);
+}
+
+template <typename PromotedType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mixed_add_impl(const T& lhs, const T& rhs) noexcept
+    -> std::enable_if_t<std::is_same<PromotedType, decimal128_t>::value, PromotedType>
+{
+    return d128_add_impl_narrow<PromotedType>(lhs, rhs);
+}
+
+template <typename PromotedType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mixed_add_impl(const T& lhs, const T& rhs) noexcept
+    -> std::enable_if_t<std::is_same<PromotedType, decimal_fast128_t>::value, PromotedType>
+{
+    return d128_add_impl_new<PromotedType>(lhs, rhs);
+}
+
+template <typename PromotedType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mixed_mul_impl(const T& lhs, const T& rhs) noexcept
+    -> std::enable_if_t<decimal_val_v<PromotedType> < 128 && !std::is_same<PromotedType, decimal_fast64_t>::value, PromotedType>
+{
+    return mul_impl<PromotedType>(lhs, rhs);
+}
+
+template <typename PromotedType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mixed_mul_impl(const T& lhs, const T& rhs) noexcept
+    -> std::enable_if_t<std::is_same<PromotedType, decimal_fast64_t>::value, PromotedType>
+{
+    return d64_mul_impl<PromotedType>(lhs, rhs);
+}
+
+template <typename PromotedType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mixed_mul_impl(const T& lhs, const T& rhs) noexcept
+    -> std::enable_if_t<decimal_val_v<PromotedType> >= 128, PromotedType>
+{
+    return d128_mul_impl<PromotedType>(lhs.sig, lhs.exp, lhs.sign, rhs.sig, rhs.exp, rhs.sign);
+}
+
+} // namespace detail
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal1, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal2>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(Decimal1 lhs, Decimal2 rhs) noexcept
     -> std::enable_if_t<(detail::is_decimal_floating_point_v<Decimal1> &&
@@ -25,7 +121,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator+(Decimal1 lhs, Decimal2 rhs) noexcept
                          detail::promote_args_t<Decimal1, Decimal2>>
 {
     using Promoted_Type = detail::promote_args_t<Decimal1, Decimal2>;
-    return static_cast<Promoted_Type>(lhs) + static_cast<Promoted_Type>(rhs);
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return static_cast<Promoted_Type>(lhs) + static_cast<Promoted_Type>(rhs);
+    }
+    #endif
+
+    return detail::mixed_add_impl<Promoted_Type>(detail::promote_add_components<Promoted_Type>(lhs),
+                                                 detail::promote_add_components<Promoted_Type>(rhs));
 }
 
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal1, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal2>
@@ -35,7 +139,17 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator-(Decimal1 lhs, Decimal2 rhs) noexcept
                          detail::promote_args_t<Decimal1, Decimal2>>
 {
     using Promoted_Type = detail::promote_args_t<Decimal1, Decimal2>;
-    return static_cast<Promoted_Type>(lhs) - static_cast<Promoted_Type>(rhs);
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return static_cast<Promoted_Type>(lhs) - static_cast<Promoted_Type>(rhs);
+    }
+    #endif
+
+    auto rhs_components {detail::promote_add_components<Promoted_Type>(rhs)};
+    rhs_components.sign = !rhs_components.sign;
+
+    return detail::mixed_add_impl<Promoted_Type>(detail::promote_add_components<Promoted_Type>(lhs), rhs_components);
 }
 
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal1, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal2>
@@ -45,7 +159,15 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(Decimal1 lhs, Decimal2 rhs) noexcept
                          detail::promote_args_t<Decimal1, Decimal2>>
 {
     using Promoted_Type = detail::promote_args_t<Decimal1, Decimal2>;
-    return static_cast<Promoted_Type>(lhs) * static_cast<Promoted_Type>(rhs);
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return static_cast<Promoted_Type>(lhs) * static_cast<Promoted_Type>(rhs);
+    }
+    #endif
+
+    return detail::mixed_mul_impl<Promoted_Type>(detail::promote_mul_components<Promoted_Type>(lhs),
+                                                 detail::promote_mul_components<Promoted_Type>(rhs));
 }
 
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal1, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal2>
@@ -12,6 +12,7 @@
 #include <boost/decimal/detail/u256.hpp>
 #include <boost/decimal/detail/power_tables.hpp>
 #include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/normalize.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -26,7 +27,7 @@ namespace detail {
 // 1) Returns a decimal type and lets the constructor handle with shrinking the significand
 // 2) Returns a struct of the constituent components (used with FMAs)
 
-template <typename ReturnType, typename T>
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T>
 BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto mul_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
 {
     using mul_type = std::conditional_t<decimal_val_v<T> < 64, std::uint_fast64_t, int128::uint128_t>;
@@ -40,7 +41,31 @@ BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto mul_impl(const T& l
     auto res_sig {(static_cast<mul_type>(lhs.full_significand()) * static_cast<mul_type>(rhs.full_significand()))};
     auto res_exp {lhs.biased_exponent() + rhs.biased_exponent()};
 
-    return {res_sig, res_exp, lhs.isneg() != rhs.isneg()};
+    return make_rounded<ReturnType, Mode>(res_sig, res_exp, lhs.isneg() != rhs.isneg());
+}
+
+// The magnitude of an integer of up to 64 bits is used directly as a significand with exponent 0.
+// The product of a 32-bit integer and a decimal32_t significand fits in 64 bits,
+// and every other product in 128 bits, so it is exact and rounded once by the constructor.
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer,
+          std::enable_if_t<(sizeof(Unsigned_Integer) <= sizeof(std::uint64_t)), bool> = true>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto mul_integer_impl(const T& lhs, const Unsigned_Integer rhs_sig, const bool rhs_sign) noexcept -> ReturnType
+{
+    using mul_type = std::conditional_t<decimal_val_v<ReturnType> < 64 && sizeof(Unsigned_Integer) <= sizeof(std::uint32_t), std::uint64_t, int128::uint128_t>;
+
+    return make_rounded<ReturnType, Mode>(mul_type{lhs.full_significand()} * rhs_sig, lhs.biased_exponent(), lhs.isneg() != rhs_sign);
+}
+
+// 128-bit integers can have more digits than the product can hold, so they are rounded to the precision of ReturnType first
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T, typename Unsigned_Integer,
+          std::enable_if_t<(sizeof(Unsigned_Integer) > sizeof(std::uint64_t)), bool> = true>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto mul_integer_impl(const T& lhs, Unsigned_Integer rhs_sig, const bool rhs_sign) noexcept -> ReturnType
+{
+    std::int32_t rhs_exp {};
+    normalize<ReturnType>(rhs_sig, rhs_exp);
+
+    return make_rounded<ReturnType, Mode>(int128::uint128_t{lhs.full_significand()} * static_cast<std::uint64_t>(rhs_sig),
+                                          lhs.biased_exponent() + rhs_exp, lhs.isneg() != rhs_sign);
 }
 
 template <typename ReturnType, typename T, typename U>
@@ -56,14 +81,22 @@ BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto mul_impl(T lhs_sig,
     // digits10 + 1 for rounding which is 8 decimal digits
 
     constexpr auto ten_pow_five {pow10(static_cast<mul_type>(5))};
-    auto res_sig {(static_cast<mul_type>(lhs_sig) * static_cast<mul_type>(rhs_sig)) / ten_pow_five};
+    const auto product {static_cast<mul_type>(lhs_sig) * static_cast<mul_type>(rhs_sig)};
+    auto res_sig {product / ten_pow_five};
+
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+    if (res_sig * ten_pow_five != product)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
     auto res_exp {lhs_exp + rhs_exp + static_cast<U>(5)};
 
     return {static_cast<std::uint32_t>(res_sig), res_exp, lhs_sign != rhs_sign};
 }
 
 // In the fast case we are better served doing our 128-bit division here since we are at a know starting point
-template <typename ReturnType, typename T>
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, typename T>
 BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_mul_impl(const T& lhs, const T& rhs) noexcept -> ReturnType
 {
     using unsigned_int128_type = boost::int128::uint128_t;
@@ -77,11 +110,19 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_mul_impl(const T& lhs, const T& rhs) noexc
     // uint_fast64_t instead. 32 - 13 = 19 or 31 - 13 = 18 which are both still greater than
     // digits10 + 1 for rounding which is 17 decimal digits
 
+    const auto product {static_cast<unsigned_int128_type>(lhs.full_significand()) * static_cast<unsigned_int128_type>(rhs.full_significand())};
+    const auto res_sig {static_cast<std::uint64_t>(div_pow10(product, 13))};
+
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
     constexpr auto ten_pow_13 {pow10(static_cast<unsigned_int128_type>(13))};
-    const auto res_sig {static_cast<std::uint64_t>((static_cast<unsigned_int128_type>(lhs.full_significand()) * static_cast<unsigned_int128_type>(rhs.full_significand())) / ten_pow_13)};
+    if (res_sig * ten_pow_13 != product)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
     const auto res_exp {lhs.biased_exponent() + rhs.biased_exponent() + 13};
 
-    return ReturnType{res_sig, res_exp, lhs.isneg() != rhs.isneg()};
+    return make_rounded<ReturnType, Mode>(res_sig, res_exp, lhs.isneg() != rhs.isneg());
 }
 
 template <typename ReturnType, BOOST_DECIMAL_INTEGRAL T, BOOST_DECIMAL_INTEGRAL U>
@@ -100,8 +141,16 @@ BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_mul_impl(T lhs_
     // uint_fast64_t instead. 32 - 13 = 19 or 31 - 13 = 18 which are both still greater than
     // digits10 + 1 for rounding which is 17 decimal digits
 
+    const auto product {static_cast<unsigned_int128_type>(lhs_sig) * static_cast<unsigned_int128_type>(rhs_sig)};
+    auto res_sig {div_pow10(product, 13)};
+
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
     constexpr auto ten_pow_13 {pow10(static_cast<unsigned_int128_type>(13))};
-    auto res_sig {(static_cast<unsigned_int128_type>(lhs_sig) * static_cast<unsigned_int128_type>(rhs_sig)) / ten_pow_13};
+    if (res_sig * ten_pow_13 != product)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
     auto res_exp {lhs_exp + rhs_exp + static_cast<U>(13)};
 
     return {static_cast<std::uint64_t>(res_sig), res_exp, lhs_sign != rhs_sign};
@@ -132,7 +181,7 @@ BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_mul_impl(T lhs_
 
     const auto sig_dig {res_sig >= comp_value ? 32 : 31};
     constexpr auto max_dig {std::numeric_limits<typename ReturnType::significand_type>::digits10};
-    res_sig /= detail::pow10(static_cast<unsigned_int128_type>(sig_dig - max_dig));
+    res_sig = detail::div_pow10(res_sig, sig_dig - max_dig);
     res_exp += sig_dig - max_dig;
 
     const auto res_sig_64 {static_cast<typename ReturnType::significand_type>(res_sig)};
@@ -145,32 +194,47 @@ BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto d64_mul_impl(T lhs_
     return {res_sig_64, res_exp, sign};
 }
 
-template <typename ReturnType, BOOST_DECIMAL_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL U1,
-                               BOOST_DECIMAL_INTEGRAL T2, BOOST_DECIMAL_INTEGRAL U2>
+// Shared by every multiplication that produces the full 256-bit product of two significands
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode, BOOST_DECIMAL_INTEGRAL U>
 BOOST_DECIMAL_FORCE_INLINE
-BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_mul_impl(const T1& lhs_sig, const U1 lhs_exp, const bool lhs_sign,
-                             const T2& rhs_sig, const U2 rhs_exp, const bool rhs_sign) noexcept -> ReturnType
+BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_round_product(const u256& product, U res_exp, const bool sign) noexcept -> ReturnType
 {
-    using sig_type = T1;
-    static_assert(std::is_same<sig_type, T2>::value, "Should have a common type by this point");
-
-    const bool sign {lhs_sign != rhs_sign};
-
-    auto res_sig {detail::umul256(lhs_sig, rhs_sig)};
-    auto res_exp {lhs_exp + rhs_exp};
+    auto res_sig {product};
     const auto sig_dig {detail::num_digits(res_sig)};
 
     // 34 is the number of digits in the d128 significand
     // this way we can skip rounding in the constructor a second time
-    const auto digit_delta {sig_dig - std::numeric_limits<sig_type>::digits10};
+    const auto digit_delta {sig_dig - std::numeric_limits<int128::uint128_t>::digits10};
     if (BOOST_DECIMAL_LIKELY(digit_delta > 0))
     {
         auto biased_exp {res_exp + detail::bias_v<ReturnType>};
-        detail::coefficient_rounding<ReturnType>(res_sig, res_exp, biased_exp, sign, sig_dig);
+        detail::coefficient_rounding<ReturnType, Mode>(res_sig, res_exp, biased_exp, sign, sig_dig);
     }
 
     BOOST_DECIMAL_ASSERT((res_sig[3] | res_sig[2]) == 0U);
-    return {int128::uint128_t{res_sig[1], res_sig[0]}, res_exp, sign};
+    return make_rounded<ReturnType, Mode>(int128::uint128_t{res_sig[1], res_sig[0]}, res_exp, sign);
+}
+
+template <typename ReturnType, rounding_mode Mode = runtime_rounding_mode,
+          BOOST_DECIMAL_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL U1,
+          BOOST_DECIMAL_INTEGRAL T2, BOOST_DECIMAL_INTEGRAL U2>
+BOOST_DECIMAL_FORCE_INLINE
+BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_mul_impl(const T1& lhs_sig, const U1 lhs_exp, const bool lhs_sign,
+                             const T2& rhs_sig, const U2 rhs_exp, const bool rhs_sign) noexcept -> ReturnType
+{
+    using sig_type = T1;
+    static_assert(std::is_same<sig_type, T2>::value, "Should have a common type by this point");
+
+    // Most values carry fewer than 20 significant digits, in which case the product of the significands
+    // is a single 64x64 -> 128-bit multiplication which can not overflow.
+    // The constructor rounds products of more than 34 digits in 128-bit arithmetic,
+    // so the 256-bit product and its reduction are only needed for wider significands.
+    if ((lhs_sig.high | rhs_sig.high) == 0U)
+    {
+        return make_rounded<ReturnType, Mode>(int128::uint128_t{lhs_sig.low} * rhs_sig.low, lhs_exp + rhs_exp, lhs_sign != rhs_sign);
+    }
+
+    return d128_round_product<ReturnType, Mode>(detail::umul256(lhs_sig, rhs_sig), lhs_exp + rhs_exp, lhs_sign != rhs_sign);
 }
 
 template <typename ReturnType, BOOST_DECIMAL_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL U1,
@@ -183,11 +247,18 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto d128_fast_mul_impl(const T1& lhs_sig, const U1
 
     // Once we have the normalized significands and exponents all we have to do is
     // multiply the significands and add the exponents
-    auto res_sig {detail::umul256(lhs_sig, rhs_sig)};
+    const auto product {detail::umul256(lhs_sig, rhs_sig)};
     const auto res_exp {lhs_exp + rhs_exp + 30};
 
+    const auto res_sig {detail::div_pow10(product, 30)};
+
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
     constexpr auto ten_pow_30 {detail::pow10(static_cast<int128::uint128_t>(30))};
-    res_sig /= ten_pow_30;
+    if (res_sig * ten_pow_30 != product)
+    {
+        raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
 
     BOOST_DECIMAL_ASSERT((res_sig[3] | res_sig[2]) == 0U); // LCOV_EXCL_LINE
     return {int128::uint128_t{res_sig[1], res_sig[0]}, res_exp, sign};
@@ -10,6 +10,7 @@
 #include <boost/decimal/detail/from_chars_integer_impl.hpp>
 #include <boost/decimal/detail/integer_search_trees.hpp>
 #include <boost/decimal/detail/chars_format.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cerrno>
@@ -351,6 +352,14 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto parser(const char* first, const char* last, bo
         bool found_dot = false;
         while (next != last && (char_validation_func(*next) || *next == '.'))
         {
+            // Dropping a non-zero digit is inexact
+            #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+            if (*next != '0' && *next != '.')
+            {
+                raise_status(status_flags::fe_dec_inexact);
+            }
+            #endif
+
             ++next;
             if (!fractional && !found_dot)
             {
@@ -11,6 +11,7 @@
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/u256.hpp>
 #include "int128.hpp"
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
@@ -30,6 +31,16 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto rotr(UInt n, unsigned int r) noexcept
     return (n >> r) | (n << ((bit_width - r) & (bit_width - 1)));
 }
 
+// The u256 shifts take their amount as an int
+template <std::size_t bit_width>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto rotr(const u256& n, unsigned int r) noexcept -> u256
+{
+    static_assert(bit_width == 256U, "A u256 is rotated over all of its bits");
+
+    r &= (bit_width - 1);
+    return (n >> static_cast<int>(r)) | (n << static_cast<int>((bit_width - r) & (bit_width - 1)));
+}
+
 // For internal use only and changes based on the type of T
 #ifdef __GNUC__
 #  pragma GCC diagnostic push
@@ -121,9 +132,12 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto remove_trailing_zeros(std::uint64_t n) noexcep
 
 BOOST_DECIMAL_CUDA_CONSTEXPR auto remove_trailing_zeros(boost::int128::uint128_t n) noexcept -> remove_trailing_zeros_return<boost::int128::uint128_t>
 {
-    if (n == boost::int128::uint128_t{0})
+    // Values that fit in one word take the 64-bit search, which needs one multiplication per step instead of three
+    // and also handles zero
+    if (n.high == UINT64_C(0))
     {
-        return {boost::int128::uint128_t{0}, 0U};
+        const auto narrow {remove_trailing_zeros(n.low)};
+        return {boost::int128::uint128_t{narrow.trimmed_number}, narrow.number_of_removed_zeros};
     }
 
     std::size_t s {};
@@ -161,15 +175,69 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto remove_trailing_zeros(boost::int128::uint128_t
     return {n, s};
 }
 
+// A u256 holds up to 77 trailing zeros, so the search starts at 64 instead of 32.
+// The multipliers are the inverses of 5^k modulo 2^256.
+BOOST_DECIMAL_CUDA_CONSTEXPR auto remove_trailing_zeros(const u256& x) noexcept -> remove_trailing_zeros_return<u256>
+{
+    // Values that fit in two words take the 128-bit search, which also handles zero
+    if ((x[3] | x[2]) == UINT64_C(0))
+    {
+        const auto narrow {remove_trailing_zeros(boost::int128::uint128_t{x[1], x[0]})};
+        return {u256{narrow.trimmed_number}, narrow.number_of_removed_zeros};
+    }
+
+    auto n {x};
+    std::size_t s {};
+
+    auto r = rotr<256>(n * u256 {UINT64_C(0x47C1525A738D3C3B), UINT64_C(0x9182B701BB5E0860), UINT64_C(0x3013034B176CDDCA), UINT64_C(0xF54526299156E101)}, 64);
+    auto b = r < u256 {UINT64_C(0x0), UINT64_C(0x0), UINT64_C(0x0), UINT64_C(0xA87FEA27A54)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    r = rotr<256>(n * u256 {UINT64_C(0x56ED97204D2DBAA4), UINT64_C(0x28EA0593CD2AEA56), UINT64_C(0x62B42691AD836EB1), UINT64_C(0x16590F420A835081)}, 32);
+    b = r < u256 {UINT64_C(0x0), UINT64_C(0x33EC47), UINT64_C(0xAB514E652E99F786), UINT64_C(0x3B696052BC82D6C7)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    r = rotr<256>(n * u256 {UINT64_C(0xDFD55A2EF7FED2DA), UINT64_C(0xD3BD6D84EB0053), UINT64_C(0xF60B3275305C1066), UINT64_C(0xE4A4D1417CD9A041)}, 16);
+    b = r < u256 {UINT64_C(0x734), UINT64_C(0xACA5F6226F0ADA61), UINT64_C(0x75F343CC4D4D9DFB), UINT64_C(0x8B60D6E93F84291F)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    r = rotr<256>(n * u256 {UINT64_C(0xACBE0E98F503F888), UINT64_C(0x1186E60DBB7F727B), UINT64_C(0xF36B7213EE9F5A78), UINT64_C(0xC767074B22E90E21)}, 8);
+    b = r < u256 {UINT64_C(0x2AF31DC461), UINT64_C(0x1873BF3F70834ACD), UINT64_C(0xAE9F0F4F534F5D60), UINT64_C(0x585A5F1C1A3CED1C)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    r = rotr<256>(n * u256 {UINT64_C(0xBC01A36E2EB1C432), UINT64_C(0xCA57A786C226809D), UINT64_C(0x495182A9930BE0DE), UINT64_C(0xD288CE703AFB7E91)}, 4);
+    b = r < u256 {UINT64_C(0x68DB8BAC710CB), UINT64_C(0x295E9E1B089A0275), UINT64_C(0x25460AA64C2F837B), UINT64_C(0x4A2339C0EBEDFA44)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    r = rotr<256>(n * u256 {UINT64_C(0x5C28F5C28F5C28F5), UINT64_C(0xC28F5C28F5C28F5C), UINT64_C(0x28F5C28F5C28F5C2), UINT64_C(0x8F5C28F5C28F5C29)}, 2);
+    b = r < u256 {UINT64_C(0x28F5C28F5C28F5C), UINT64_C(0x28F5C28F5C28F5C2), UINT64_C(0x8F5C28F5C28F5C28), UINT64_C(0xF5C28F5C28F5C290)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    r = rotr<256>(n * u256 {UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCD)}, 1);
+    b = r < u256 {UINT64_C(0x1999999999999999), UINT64_C(0x9999999999999999), UINT64_C(0x9999999999999999), UINT64_C(0x999999999999999A)};
+    s = s * 2U + static_cast<std::size_t>(b);
+    n = b ? r : n;
+
+    return {n, s};
+}
+
 #ifdef BOOST_DECIMAL_DETAIL_INT128_HAS_INT128
 
 constexpr auto remove_trailing_zeros(boost::int128::detail::builtin_u128 n) noexcept -> remove_trailing_zeros_return<boost::int128::uint128_t>
 {
     using u128 = boost::int128::detail::builtin_u128;
 
-    if (n == u128{0})
+    // As above, values that fit in one word take the 64-bit search
+    if ((n >> 64U) == u128{0})
     {
-        return {boost::int128::uint128_t{0}, 0U};
+        const auto narrow {remove_trailing_zeros(static_cast<std::uint64_t>(n))};
+        return {boost::int128::uint128_t{narrow.trimmed_number}, narrow.number_of_removed_zeros};
     }
 
     std::size_t s {};
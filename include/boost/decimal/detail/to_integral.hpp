@@ -10,6 +10,7 @@
 #include <boost/decimal/detail/power_tables.hpp>
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cerrno>
@@ -42,6 +43,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto to_integral(Decimal val) noexcept
 
     if (isnan(val))
     {
+        detail::raise_status(status_flags::fe_dec_invalid);
+
         #if defined(__clang__) && __clang_major__ >= 20
         if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(val))
         #endif
@@ -59,6 +62,8 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto to_integral(Decimal val) noexcept
 
     if (val > max_target_type || val < min_target_type)
     {
+        detail::raise_status(status_flags::fe_dec_invalid);
+
         #if defined(__clang__) && __clang_major__ >= 20
         if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(val))
         #endif
@@ -77,6 +82,7 @@ BOOST_DECIMAL_CUDA_CONSTEXPR auto to_integral(Decimal val) noexcept
     {
         if (expval > std::numeric_limits<Conversion_Type>::digits10 + 1)
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return std::numeric_limits<TargetType>::max();
         }
 
@@ -110,6 +116,8 @@ constexpr auto to_integral_128(Decimal val) noexcept
 
     if (isnan(val))
     {
+        detail::raise_status(status_flags::fe_dec_invalid);
+
         #if defined(__clang__) && __clang_major__ >= 20
         if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(val))
         #endif
@@ -128,6 +136,8 @@ constexpr auto to_integral_128(Decimal val) noexcept
 
     if (val > max_target_type || val < min_target_type)
     {
+        detail::raise_status(status_flags::fe_dec_invalid);
+
         #if defined(__clang__) && __clang_major__ >= 20
         if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(val))
         #endif
@@ -146,6 +156,7 @@ constexpr auto to_integral_128(Decimal val) noexcept
     {
         if (expval > std::numeric_limits<int128::uint128_t>::digits)
         {
+            detail::raise_status(status_flags::fe_dec_invalid);
             return std::numeric_limits<TargetType>::max();
         }
 
@@ -224,6 +224,13 @@ struct conjunction<B1, Bn...>
 template <typename... B>
 BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE bool conjunction_v = conjunction<B...>::value;
 
+// Keeps a parameter out of template argument deduction, as std::type_identity_t does in C++20
+template <typename T>
+struct type_identity { using type = T; };
+
+template <typename T>
+using type_identity_t = typename type_identity<T>::type;
+
 } // namespace detail
 } // namespace decimal
 } // namespace boost
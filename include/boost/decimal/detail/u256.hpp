@@ -765,123 +765,68 @@ BOOST_DECIMAL_CUDA_CONSTEXPR u256& u256::operator++(int) noexcept
     return *this;
 }
 
-
 //=====================================
-// Multiplication Operators
+// Subtraction Operators
 //=====================================
 
-namespace impl {
-
-#if defined(__GNUC__) && __GNUC__ >= 8
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wclass-memaccess"
-#endif
-
-template <std::size_t word_size>
-BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 from_words(const std::uint32_t (&words)[word_size]) noexcept
+// Wraps modulo 2^256 like the builtin unsigned types
+BOOST_DECIMAL_CUDA_CONSTEXPR u256 operator-(const u256& lhs, const u256& rhs) noexcept
 {
-    static_assert(word_size >= 8, "Not enough words to convert to u256");
-
-    u256 result {};
+    u256 result;
+    std::uint64_t borrow {};
 
-    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !BOOST_DECIMAL_ENDIAN_BIG_BYTE
-    if (!BOOST_DECIMAL_DETAIL_INT128_IS_CONSTANT_EVALUATED(words))
+    for (std::size_t i {}; i < 4U; ++i)
     {
-        std::memcpy(&result, words, sizeof(result));
-    }
-    else
-    #endif
-    {
-        result[0] = static_cast<std::uint64_t>(words[0]) | (static_cast<std::uint64_t>(words[1]) << 32);
-        result[1] = static_cast<std::uint64_t>(words[2]) | (static_cast<std::uint64_t>(words[3]) << 32);
-        result[2] = static_cast<std::uint64_t>(words[4]) | (static_cast<std::uint64_t>(words[5]) << 32);
-        result[3] = static_cast<std::uint64_t>(words[6]) | (static_cast<std::uint64_t>(words[7]) << 32);
+        const auto diff {lhs[i] - rhs[i]};
+        result[i] = diff - borrow;
+        borrow = (lhs[i] < rhs[i] || diff < borrow) ? 1U : 0U;
     }
 
     return result;
 }
 
-#if defined(__GNUC__) && __GNUC__ >= 7
-#pragma GCC diagnostic pop
-#endif
+//=====================================
+// Multiplication Operators
+//=====================================
 
-template <std::size_t u_size, std::size_t v_size>
-BOOST_DECIMAL_CUDA_CONSTEXPR u256 knuth_mulitply(const std::uint32_t (&u)[u_size],
-                              const std::uint32_t (&v)[v_size]) noexcept
+namespace impl {
+
+// Low 256 bits of lhs * rhs, where only the first rhs_words words of rhs can be non-zero.
+// Each partial product is a 64 x 64 -> 128-bit multiplication, and the sum of a partial product,
+// a word of the result and a carry word can not overflow 128 bits.
+template <std::size_t rhs_words>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 schoolbook_mul(const u256& lhs, const u256& rhs) noexcept
 {
-    std::uint32_t w[u_size + v_size] {};
+    u256 result {};
 
-    // M.1
-    for (std::size_t j {}; j < v_size; ++j)
+    for (std::size_t i {}; i < rhs_words; ++i)
     {
-        // M.2
-        if (v[j] == 0)
-        {
-            w[j + u_size] = 0u;
-            continue;
-        }
-
-        // M.3
-        std::uint64_t t {};
-        for (std::size_t i {}; i < u_size; ++i)
+        std::uint64_t carry {};
+        for (std::size_t j {}; i + j < 4U; ++j)
         {
-            // M.4
-            t += static_cast<std::uint64_t>(u[i]) * v[j] + w[i + j];
-            w[i + j] = static_cast<std::uint32_t>(t);
-            t >>= 32u;
+            const auto t {int128::uint128_t{lhs[j]} * rhs[i] + result[i + j] + carry};
+            result[i + j] = t.low;
+            carry = t.high;
         }
-
-        // M.5
-        w[j + u_size] = static_cast<std::uint32_t>(t);
     }
 
-    return from_words(w);
-}
-
-BOOST_DECIMAL_CUDA_CONSTEXPR void to_words(const u256& x, std::uint32_t (&words)[8]) noexcept
-{
-    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !BOOST_DECIMAL_ENDIAN_BIG_BYTE
-    if (!BOOST_DECIMAL_DETAIL_INT128_IS_CONSTANT_EVALUATED(x))
-    {
-        std::memcpy(words, &x, sizeof(x));
-    }
-    else
-    #endif
-    {
-
-        words[0] = static_cast<std::uint32_t>(x[0] & UINT32_MAX);
-        words[1] = static_cast<std::uint32_t>(x[0] >> 32U);
-        words[2] = static_cast<std::uint32_t>(x[1] & UINT32_MAX);
-        words[3] = static_cast<std::uint32_t>(x[1] >> 32U);
-        words[4] = static_cast<std::uint32_t>(x[2] & UINT32_MAX);
-        words[5] = static_cast<std::uint32_t>(x[2] >> 32U);
-        words[6] = static_cast<std::uint32_t>(x[3] & UINT32_MAX);
-        words[7] = static_cast<std::uint32_t>(x[3] >> 32U);
-    }
+    return result;
 }
 
 template <typename UnsignedInteger>
 BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_mul(const u256& lhs, const UnsignedInteger& rhs) noexcept
 {
-    using boost::decimal::detail::impl::to_words;
-    using boost::int128::detail::to_words;
-
-    constexpr std::size_t rhs_words_needed {sizeof(UnsignedInteger) / sizeof(std::uint32_t)};
-
-    std::uint32_t lhs_words[8] {};
-    std::uint32_t rhs_words[rhs_words_needed] {};
+    using word_type = std::conditional_t<(sizeof(UnsignedInteger) > sizeof(std::uint64_t)), int128::uint128_t, std::uint64_t>;
+    constexpr std::size_t rhs_words {sizeof(word_type) / sizeof(std::uint64_t)};
 
-    to_words(lhs, lhs_words);
-    to_words(rhs, rhs_words);
-
-    return knuth_mulitply(lhs_words, rhs_words);
+    return schoolbook_mul<rhs_words>(lhs, u256{static_cast<word_type>(rhs)});
 }
 
 } // namespace impl
 
 BOOST_DECIMAL_CUDA_CONSTEXPR u256 operator*(const u256& lhs, const u256& rhs) noexcept
 {
-    return impl::default_mul(lhs, rhs);
+    return impl::schoolbook_mul<4U>(lhs, rhs);
 }
 
 template <typename UnsignedInteger>
@@ -898,29 +843,16 @@ BOOST_DECIMAL_CUDA_CONSTEXPR u256 operator*(const UnsignedInteger lhs, const u25
 
 BOOST_DECIMAL_CUDA_CONSTEXPR u256 umul256(const int128::uint128_t& a, const int128::uint128_t& b) noexcept
 {
-    u256 result{};
-
-    const int128::uint128_t a_low {a.low};
-    const int128::uint128_t a_high {a.high};
-    const auto b_low {b.low};
-    const auto b_high {b.high};
-
-    const auto p0 = a_low * b_low;
-    const auto p1 = a_low * b_high;
-    const auto p2 = a_high * b_low;
-    const auto p3 = a_high * b_high;
-
-    // Combine results
-    const auto middle = p1 + p2 + p0.high;
-
-    result.bytes[0] = p0.low;
-    result.bytes[1] = middle.low;
+    const auto p0 {int128::uint128_t{a.low} * b.low};
+    const auto p1 {int128::uint128_t{a.low} * b.high};
+    const auto p2 {int128::uint128_t{a.high} * b.low};
+    const auto p3 {int128::uint128_t{a.high} * b.high};
 
-    const auto high_sum = middle.high + p3;
-    result.bytes[2] = high_sum.low;
-    result.bytes[3] = high_sum.high;
+    // Each sum of words is accumulated in 128 bits, so no carry is lost for any pair of inputs
+    const auto middle {int128::uint128_t{p0.high} + p1.low + p2.low};
+    const auto high {p3 + p1.high + p2.high + middle.high};
 
-    return result;
+    return {high.high, high.low, middle.low, p0.low};
 }
 
 // 128×64→256 multiplication (SoftFloat-style lightweight primitive)
@@ -955,174 +887,355 @@ BOOST_DECIMAL_CUDA_CONSTEXPR u256& u256::operator*=(const u256& rhs) noexcept
 
 namespace impl {
 
-BOOST_DECIMAL_CUDA_CONSTEXPR std::size_t div_to_words(const u256& x, std::uint32_t (&words)[8]) noexcept
+// Division uses the normalized reciprocals of Möller and Granlund,
+// "Improved Division by Invariant Integers", IEEE Transactions on Computers 60 (2011).
+// Once the reciprocal of the divisor is known each quotient word costs a couple of
+// 64 x 64 -> 128-bit multiplications instead of a division.
+
+struct u256_divmod_result
 {
-    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !BOOST_DECIMAL_ENDIAN_BIG_BYTE
-    if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(x))
-    {
-        std::memcpy(words, &x, sizeof(x));
-    }
-    else
-    #endif
+    u256 quotient;
+    u256 remainder;
+};
+
+// floor((2^128 - 1) / d) - 2^64 for a divisor with the most significant bit set.
+// The quotient fits in 64 bits, so with a native 128-bit type this is a single hardware division,
+// which measured faster than the Newton iteration of Algorithm 2 in the paper.
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto reciprocal_2by1(const std::uint64_t d) noexcept -> std::uint64_t
+{
+    BOOST_DECIMAL_ASSERT(d >= UINT64_C(0x8000000000000000));
+
+    return (int128::uint128_t{~d, UINT64_MAX} / int128::uint128_t{d}).low;
+}
+
+// Reciprocal of the 128-bit normalized divisor d1:d0 used by div_3by2
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto reciprocal_3by2(const std::uint64_t d1, const std::uint64_t d0) noexcept -> std::uint64_t
+{
+    auto v {reciprocal_2by1(d1)};
+    auto p {d1 * v + d0};
+
+    if (p < d0)
     {
-        words[0] = static_cast<std::uint32_t>(x[0] & UINT32_MAX);
-        words[1] = static_cast<std::uint32_t>(x[0] >> 32U);
-        words[2] = static_cast<std::uint32_t>(x[1] & UINT32_MAX);
-        words[3] = static_cast<std::uint32_t>(x[1] >> 32U);
-        words[4] = static_cast<std::uint32_t>(x[2] & UINT32_MAX);
-        words[5] = static_cast<std::uint32_t>(x[2] >> 32U);
-        words[6] = static_cast<std::uint32_t>(x[3] & UINT32_MAX);
-        words[7] = static_cast<std::uint32_t>(x[3] >> 32U);
+        --v;
+        if (p >= d1)
+        {
+            --v;
+            p -= d1;
+        }
+        p -= d1;
     }
 
-    std::size_t word_count {8};
-    while (words[word_count - 1U] == 0U)
+    const auto t {int128::uint128_t{v} * d0};
+    p += t.high;
+
+    if (p < t.high)
     {
-        --word_count;
+        --v;
+        if (p >= d1 && (p > d1 || t.low >= d0))
+        {
+            --v;
+        }
     }
 
-    return word_count;
+    return v;
 }
 
-BOOST_DECIMAL_CUDA_CONSTEXPR std::size_t div_to_words(const boost::int128::uint128_t& x, std::uint32_t (&words)[8]) noexcept
+// Divides u1:u0 by the normalized d with reciprocal v, where u1 < d
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_2by1(const std::uint64_t u1, const std::uint64_t u0,
+                                                                      const std::uint64_t d, const std::uint64_t v,
+                                                                      std::uint64_t& remainder) noexcept -> std::uint64_t
 {
-    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !BOOST_DECIMAL_ENDIAN_BIG_BYTE
-    if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(x))
+    const auto q {int128::uint128_t{v} * u1 + int128::uint128_t{u1, u0}};
+    auto q1 {q.high + 1U};
+    auto r {u0 - q1 * d};
+
+    // This correction is taken about half the time, so it is done with a mask rather than a branch
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r > q.low)};
+    q1 += mask;
+    r += mask & d;
+
+    if (BOOST_DECIMAL_UNLIKELY(r >= d))
     {
-        std::memcpy(words, &x, sizeof(boost::int128::uint128_t));
+        ++q1;
+        r -= d;
     }
-    else
-    #endif
+
+    remainder = r;
+    return q1;
+}
+
+// Divides u2:u1:u0 by the normalized d with reciprocal v, where u2:u1 < d
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_3by2(const std::uint64_t u2, const std::uint64_t u1, const std::uint64_t u0,
+                                                                      const int128::uint128_t d, const std::uint64_t v,
+                                                                      int128::uint128_t& remainder) noexcept -> std::uint64_t
+{
+    const auto q {int128::uint128_t{v} * u2 + int128::uint128_t{u2, u1}};
+    const auto r1 {u1 - q.high * d.high};
+    const auto t {int128::uint128_t{d.low} * q.high};
+    auto r {int128::uint128_t{r1, u0} - t - d};
+    auto q1 {q.high + 1U};
+
+    const auto mask {UINT64_C(0) - static_cast<std::uint64_t>(r.high >= q.low)};
+    q1 += mask;
+    r += int128::uint128_t{mask & d.high, mask & d.low};
+
+    if (BOOST_DECIMAL_UNLIKELY(r >= d))
     {
-        words[0] = static_cast<std::uint32_t>(x.low & UINT32_MAX);                              // LCOV_EXCL_LINE
-        words[1] = static_cast<std::uint32_t>(x.low >> 32);                                     // LCOV_EXCL_LINE
-        words[2] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(x.high) & UINT32_MAX); // LCOV_EXCL_LINE
-        words[3] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(x.high) >> 32);        // LCOV_EXCL_LINE
+        ++q1;
+        r -= d;
     }
 
-    BOOST_DECIMAL_DETAIL_INT128_ASSERT_MSG(x != 0U, "Division by 0"); // LCOV_EXCL_LINE : False Negative
+    remainder = r;
+    return q1;
+}
+
+// Knuth's algorithm D on 64-bit words for divisors of three or four words (TAOCP Vol. 2 4.3.1).
+// Each quotient word is estimated from the top three words of the remainder with div_3by2,
+// which is at most one too large. u holds the normalized dividend of m words plus its extension word,
+// and is left with the remainder.
+BOOST_DECIMAL_CUDA_CONSTEXPR auto knuth_div_words(std::uint64_t (&u)[5], const std::size_t m,
+                                                   const std::uint64_t (&d)[4], const std::size_t n, u256& q) noexcept -> void
+{
+    const int128::uint128_t divisor {d[n - 1U], d[n - 2U]};
+    const auto v {reciprocal_3by2(divisor.high, divisor.low)};
 
-    std::size_t word_count {4};
-    while (words[word_count - 1U] == 0U)
+    for (std::size_t j {m - n + 1U}; j-- > 0U;)
     {
-        word_count--;
-    }
+        const auto u2 {u[j + n]};
+        const auto u1 {u[j + n - 1U]};
+        const auto u0 {u[j + n - 2U]};
+
+        int128::uint128_t rhat {};
+        auto qhat {UINT64_MAX};
+        std::size_t subtract_words {n};
+
+        if (BOOST_DECIMAL_UNLIKELY((int128::uint128_t{u2, u1} == divisor)))
+        {
+            // The estimate overflows a word, so the full divisor is multiplied and subtracted
+            rhat = int128::uint128_t{u2, u1};
+        }
+        else
+        {
+            // The top two words of the divisor are already accounted for in rhat
+            qhat = div_3by2(u2, u1, u0, divisor, v, rhat);
+            subtract_words = n - 2U;
+        }
+
+        // u[j .. j + subtract_words) -= qhat * d[0 .. subtract_words)
+        std::uint64_t borrow {};
+        for (std::size_t i {}; i < subtract_words; ++i)
+        {
+            const auto product {int128::uint128_t{qhat} * d[i]};
+            const auto s {u[j + i] - borrow};
+            const auto t {s - product.low};
+            borrow = product.high + static_cast<std::uint64_t>(s > u[j + i]) + static_cast<std::uint64_t>(t > s);
+            u[j + i] = t;
+        }
+
+        bool negative {};
+        if (subtract_words == n)
+        {
+            negative = borrow > u2;
+            u[j + n] = u2 - borrow;
+        }
+        else
+        {
+            const auto top {rhat - int128::uint128_t{borrow}};
+            negative = top > rhat;
+            u[j + n - 2U] = top.low;
+            u[j + n - 1U] = top.high;
+        }
+
+        // The estimate was one too large so add the divisor back
+        if (BOOST_DECIMAL_UNLIKELY(negative))
+        {
+            --qhat;
+
+            std::uint64_t carry {};
+            for (std::size_t i {}; i < n; ++i)
+            {
+                const auto sum {int128::uint128_t{u[j + i]} + d[i] + carry};
+                u[j + i] = sum.low;
+                carry = sum.high;
+            }
+        }
 
-    return word_count;
+        q[j] = qhat;
+    }
 }
 
-BOOST_DECIMAL_CUDA_CONSTEXPR std::size_t div_to_words(const std::uint64_t x, std::uint32_t (&words)[2]) noexcept
+// With a single quotient word the reciprocal does not pay for itself, so the quotient is estimated
+// with one division of the top two words of the normalized dividend by the top word of the divisor.
+// The estimate is at most two too large (TAOCP Vol. 2 4.3.1 Theorem B). u is left with the remainder.
+BOOST_DECIMAL_CUDA_CONSTEXPR auto single_word_quotient(std::uint64_t (&u)[5], const std::uint64_t (&d)[4], const std::size_t n) noexcept -> std::uint64_t
 {
-    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !BOOST_DECIMAL_ENDIAN_BIG_BYTE
-    if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(x))
+    auto qhat {(int128::uint128_t{u[n], u[n - 1U]} / int128::uint128_t{d[n - 1U]}).low};
+
+    std::uint64_t borrow {};
+    for (std::size_t i {}; i < n; ++i)
     {
-        std::memcpy(words, &x, sizeof(std::uint64_t));
+        const auto product {int128::uint128_t{qhat} * d[i]};
+        const auto s {u[i] - borrow};
+        const auto t {s - product.low};
+        borrow = product.high + static_cast<std::uint64_t>(s > u[i]) + static_cast<std::uint64_t>(t > s);
+        u[i] = t;
     }
-    else
-    #endif
+
+    // The remainder is smaller than the divisor, so its top word is only non-zero while it is negative
+    auto top {u[n] - borrow};
+    while (BOOST_DECIMAL_UNLIKELY(top != 0U))
     {
-        words[0] = static_cast<std::uint32_t>(x & UINT32_MAX);
-        words[1] = static_cast<std::uint32_t>(x >> 32);
+        --qhat;
+
+        std::uint64_t carry {};
+        for (std::size_t i {}; i < n; ++i)
+        {
+            const auto sum {int128::uint128_t{u[i]} + d[i] + carry};
+            u[i] = sum.low;
+            carry = sum.high;
+        }
+
+        top += carry;
     }
 
-    BOOST_DECIMAL_DETAIL_INT128_ASSERT_MSG(x != 0U, "Division by 0");
+    return qhat;
+}
 
-    std::size_t word_count {2};
-    while (words[word_count - 1U] == 0U)
+// Number of words up to the most significant non-zero word
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto significant_words(const u256& x) noexcept -> std::size_t
+{
+    std::size_t n {4U};
+    while (n > 0U && x[n - 1U] == 0U)
     {
-        word_count--;
+        --n;
     }
 
-    return word_count;
+    return n;
 }
 
-BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_div(const u256& lhs, const std::uint64_t rhs) noexcept
+// Division by a divisor of two or more words, where lhs >= rhs.
+// The divisor is shifted until its top bit is set, and the dividend is shifted by the same amount
+// into an extension word, which is smaller than the top word of the divisor.
+// Only the quotient words below the top word of the dividend are computed.
+BOOST_DECIMAL_CUDA_CONSTEXPR auto div_mod_impl(const u256& lhs, const u256& rhs) noexcept -> u256_divmod_result
 {
-    u256 quotient;
+    const auto m {significant_words(lhs)};
+    const auto n {significant_words(rhs)};
 
-    int128::uint128_t current {lhs[3]};
-    quotient[3] = static_cast<std::uint64_t>(current / rhs);
-    auto remainder = static_cast<std::uint64_t>(current % rhs);
+    BOOST_DECIMAL_ASSERT(n >= 2U && m >= n);
 
-    current = static_cast<int128::uint128_t>(remainder) << 64U | lhs[2];
-    quotient[2] = static_cast<std::uint64_t>(current / rhs);
-    remainder = static_cast<std::uint64_t>(current % rhs);
+    const auto shift {int128::detail::countl_zero(rhs[n - 1U])};
 
-    current = static_cast<int128::uint128_t>(remainder) << 64U | lhs[1];
-    quotient[1] = static_cast<std::uint64_t>(current / rhs);
-    remainder = static_cast<std::uint64_t>(current % rhs);
+    std::uint64_t u[5] {};
+    std::uint64_t d[4] {};
+    for (std::size_t i {}; i < 4U; ++i)
+    {
+        u[i] = lhs[i];
+        d[i] = rhs[i];
+    }
 
-    current = static_cast<int128::uint128_t>(remainder) << 64U | lhs[0];
-    quotient[0] = static_cast<std::uint64_t>(current / rhs);
+    if (shift != 0)
+    {
+        const auto bit_shift {static_cast<unsigned>(shift)};
+        u[4] = u[3] >> (64U - bit_shift);
+        for (std::size_t i {4U}; i-- > 1U;)
+        {
+            u[i] = (u[i] << bit_shift) | (u[i - 1U] >> (64U - bit_shift));
+            d[i] = (d[i] << bit_shift) | (d[i - 1U] >> (64U - bit_shift));
+        }
+        u[0] <<= bit_shift;
+        d[0] <<= bit_shift;
+    }
 
-    return quotient;
-}
+    u256 quotient {};
+    u256 remainder {};
 
-template <typename UnsignedInteger>
-BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_div(const u256& lhs, const UnsignedInteger& rhs) noexcept
-{
-    if (rhs <= UINT64_MAX)
+    if (m == n)
     {
-        return default_div(lhs, static_cast<std::uint64_t>(rhs));
+        quotient[0] = single_word_quotient(u, d, n);
+
+        for (std::size_t i {}; i < n; ++i)
+        {
+            remainder[i] = u[i];
+        }
     }
-    else if (lhs < rhs)
+    else if (n == 2U)
     {
-        return u256{};
-    }
-
-    std::uint32_t u[8] {};
-    std::uint32_t v[8] {};
-    std::uint32_t q[8] {};
+        const int128::uint128_t divisor {d[1], d[0]};
+        const auto v {reciprocal_3by2(d[1], d[0])};
+        int128::uint128_t r {u[m], u[m - 1U]};
 
-    const auto m {div_to_words(lhs, u)};
-    const auto n {div_to_words(rhs, v)};
+        for (std::size_t j {m - 1U}; j-- > 0U;)
+        {
+            quotient[j] = div_3by2(r.high, r.low, u[j], divisor, v, r);
+        }
 
-    BOOST_DECIMAL_DETAIL_INT128_ASSERT(m >= n);
+        remainder[0] = r.low;
+        remainder[1] = r.high;
+    }
+    else
+    {
+        knuth_div_words(u, m, d, n, quotient);
 
-    int128::detail::impl::knuth_divide<false>(u, m, v, n, q);
+        for (std::size_t i {}; i < n; ++i)
+        {
+            remainder[i] = u[i];
+        }
+    }
 
-    return from_words(q);
+    return {quotient, remainder >> shift};
 }
 
-struct u256_divmod_result
+// A 64-bit divisor is divided into one word of the dividend at a time, which leaves the remainder of the last word
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_mod(const u256& lhs, const std::uint64_t rhs) noexcept -> u256_divmod_result
 {
-    u256 quotient;
-    u256 remainder;
-};
+    const auto m {significant_words(lhs)};
 
-template <typename UnsignedInteger>
-BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_mod(const u256& lhs, const UnsignedInteger& rhs) noexcept -> u256_divmod_result
-{
-    std::uint32_t u[8] {};
-    std::uint32_t v[8] {};
-    std::uint32_t q[8] {};
+    if (BOOST_DECIMAL_UNLIKELY(rhs == 0U) || m == 0U)
+    {
+        return {u256{}, u256{}};
+    }
 
-    const auto m {div_to_words(lhs, u)};
-    const auto n {div_to_words(rhs, v)};
+    const auto shift {int128::detail::countl_zero(rhs)};
+    const auto d {rhs << shift};
+    const auto v {reciprocal_2by1(d)};
+    const auto normalized {lhs << shift};
 
-    BOOST_DECIMAL_DETAIL_INT128_ASSERT(m >= n);
+    u256 quotient {};
+    std::uint64_t remainder {shift == 0 ? std::uint64_t{0} : lhs[m - 1U] >> (64 - shift)};
 
-    // Simplify handling of single word division
-    // We run into this case with dividing by powers of 10 while rounding u256
-    if (n == 1U)
+    for (std::size_t i {m}; i-- > 0U;)
     {
-        std::uint64_t remainder {};
+        quotient[i] = div_2by1(remainder, normalized[i], d, v, remainder);
+    }
 
-        for (std::size_t j = m; j-- > 0;)
-        {
-            const auto dividend {(remainder << 32) | u[j]};
-            q[j] = static_cast<std::uint32_t>(dividend / v[0]);
-            remainder = dividend % v[0];
-        }
+    return {quotient, u256{remainder >> shift}};
+}
 
-        u[0] = static_cast<std::uint32_t>(remainder);
+template <typename UnsignedInteger>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto div_mod(const u256& lhs, const UnsignedInteger& rhs) noexcept -> u256_divmod_result
+{
+    if (rhs <= UINT64_MAX)
+    {
+        return div_mod(lhs, static_cast<std::uint64_t>(rhs));
     }
-    else
+    else if (lhs < rhs)
     {
-        int128::detail::impl::knuth_divide<true>(u, m, v, n, q);
+        return {u256{}, lhs};
     }
 
-     return {from_words(q), from_words(u)};
+    return div_mod_impl(lhs, u256{rhs});
+}
+
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_div(const u256& lhs, const std::uint64_t rhs) noexcept
+{
+    return div_mod(lhs, rhs).quotient;
+}
+
+template <typename UnsignedInteger>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_div(const u256& lhs, const UnsignedInteger& rhs) noexcept
+{
+    return div_mod(lhs, rhs).quotient;
 }
 
 } // namespace impl
@@ -1164,45 +1277,13 @@ namespace impl {
 
 BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_mod(const u256& lhs, const std::uint64_t rhs) noexcept
 {
-    u256 quotient;
-
-    int128::uint128_t current {lhs[3]};
-    quotient[3] = static_cast<std::uint64_t>(current / rhs);
-    auto remainder = static_cast<std::uint64_t>(current % rhs);
-
-    current = static_cast<int128::uint128_t>(remainder) << 64U | lhs[2];
-    quotient[2] = static_cast<std::uint64_t>(current / rhs);
-    remainder = static_cast<std::uint64_t>(current % rhs);
-
-    current = static_cast<int128::uint128_t>(remainder) << 64U | lhs[1];
-    quotient[1] = static_cast<std::uint64_t>(current / rhs);
-    remainder = static_cast<std::uint64_t>(current % rhs);
-
-    current = static_cast<int128::uint128_t>(remainder) << 64U | lhs[0];
-    quotient[0] = static_cast<std::uint64_t>(current / rhs);
-    remainder = static_cast<std::uint64_t>(current % rhs);
-
-    return remainder;
+    return div_mod(lhs, rhs).remainder;
 }
 
 template <typename UnsignedInteger>
 BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR u256 default_mod(const u256& lhs, const UnsignedInteger& rhs) noexcept
 {
-    if (rhs <= UINT64_MAX)
-    {
-        return default_mod(lhs, static_cast<std::uint64_t>(rhs));
-    }
-
-    std::uint32_t u[8] {};
-    std::uint32_t v[8] {};
-    std::uint32_t q[8] {};
-
-    const auto m {div_to_words(lhs, u)};
-    const auto n {div_to_words(rhs, v)};
-
-    int128::detail::impl::knuth_divide<true>(u, m, v, n, q);
-
-    return from_words(u);
+    return div_mod(lhs, rhs).remainder;
 }
 
 } // namespace impl
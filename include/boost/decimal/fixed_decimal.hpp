@@ -0,0 +1,345 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_FIXED_DECIMAL_HPP
+#define BOOST_DECIMAL_FIXED_DECIMAL_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/cfenv.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/apply_sign.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// Holds the product of two magnitudes of Rep, and a magnitude of Rep scaled by 10^Scale
+template <typename Rep>
+using fixed_wide_type = std::conditional_t<(sizeof(Rep) <= sizeof(std::uint32_t)), std::uint64_t, int128::uint128_t>;
+
+// The magnitude n / d rounded in the current rounding mode, where is_neg is the sign of the value.
+// The signs of the values are usually unpredictable, so the increment avoids branching on them.
+template <typename T>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto fixed_div_round(const T n, const T d, const bool is_neg) noexcept -> T
+{
+    const auto q {n / d};
+    const auto r {n % d};
+
+    if (r == 0U)
+    {
+        return q;
+    }
+
+    raise_status(status_flags::fe_dec_inexact);
+
+    // r is compared with d - r rather than 2r with d so that nothing overflows
+    bool round_up {};
+    switch (current_rounding_mode())
+    {
+        case rounding_mode::fe_dec_to_nearest:
+            round_up = r > d - r || (r == d - r && (q & 1U) == 1U);
+            break;
+        case rounding_mode::fe_dec_to_nearest_from_zero:
+            round_up = r >= d - r;
+            break;
+        case rounding_mode::fe_dec_downward:
+            round_up = is_neg;
+            break;
+        case rounding_mode::fe_dec_upward:
+            round_up = !is_neg;
+            break;
+        default:
+            break;
+    }
+
+    return q + static_cast<T>(round_up);
+}
+
+// The signed value of the magnitude val without a branch on the sign
+template <typename Rep>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto fixed_apply_sign(const make_unsigned_t<Rep> val, const bool is_neg) noexcept -> Rep
+{
+    using unsigned_rep = make_unsigned_t<Rep>;
+
+    const auto mask {static_cast<unsigned_rep>(0U - static_cast<unsigned_rep>(is_neg))};
+    return static_cast<Rep>((val ^ mask) - mask);
+}
+
+// Narrows the division to the magnitude type of Rep when the dividend fits in it,
+// which lets the compiler replace the division by a constant with a multiplication
+template <typename Rep, typename T>
+BOOST_DECIMAL_FORCE_INLINE BOOST_DECIMAL_CUDA_CONSTEXPR auto fixed_div_round_narrow(const T n, const T d, const bool is_neg) noexcept -> make_unsigned_t<Rep>
+{
+    using unsigned_rep = make_unsigned_t<Rep>;
+
+    if (n <= static_cast<T>((std::numeric_limits<unsigned_rep>::max)()))
+    {
+        return fixed_div_round(static_cast<unsigned_rep>(n), static_cast<unsigned_rep>(d), is_neg);
+    }
+
+    return static_cast<unsigned_rep>(fixed_div_round(n, d, is_neg));
+}
+
+// Converts val to a multiple of 10^-Scale rounded in the current rounding mode.
+// Returns false if val is NaN, infinite, or out of range of Rep.
+template <int Scale, typename Rep, typename DecimalType>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto fixed_from_decimal(const DecimalType val, Rep& raw) noexcept -> bool
+{
+    using unsigned_rep = make_unsigned_t<Rep>;
+
+    constexpr auto max_digits {std::numeric_limits<int128::uint128_t>::digits10};
+    constexpr int128::uint128_t max_raw {static_cast<unsigned_rep>((std::numeric_limits<Rep>::max)())};
+
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(val))
+    {
+        return false;
+    }
+    #endif
+
+    const auto components {get_components(val)};
+    const bool is_neg {components.sign};
+    const int scaled_exp {components.exp + Scale};
+
+    int128::uint128_t res {components.sig};
+
+    if (res == 0U)
+    {
+        raw = 0;
+        return true;
+    }
+
+    if (scaled_exp > 0)
+    {
+        if (num_digits(res) + scaled_exp > std::numeric_limits<Rep>::digits10 + 1)
+        {
+            return false;
+        }
+
+        res *= pow10(static_cast<int128::uint128_t>(scaled_exp));
+    }
+    else if (scaled_exp < 0)
+    {
+        // The significands have at most 34 digits, so dividing by a larger power of ten
+        // gives the same quotient and the same side of the midpoint
+        const auto shift {-scaled_exp > max_digits ? max_digits : -scaled_exp};
+        res = fixed_div_round(res, pow10(static_cast<int128::uint128_t>(shift)), is_neg);
+    }
+
+    if (res > max_raw)
+    {
+        return false;
+    }
+
+    raw = make_signed_value(static_cast<unsigned_rep>(res), is_neg);
+    return true;
+}
+
+} // namespace detail
+
+// A decimal fixed point number with Scale digits after the decimal point,
+// stored as an integer count of 10^-Scale in Rep.
+// Addition, subtraction and comparisons are those of Rep, and multiplication and division
+// are rounded to Scale digits in the current rounding mode.
+// Like the built-in integers, results which are out of the range of Rep are undefined.
+BOOST_DECIMAL_EXPORT template <int Scale, typename Rep = std::int64_t>
+class fixed_decimal
+{
+    static_assert(std::is_same<Rep, std::int32_t>::value || std::is_same<Rep, std::int64_t>::value,
+                  "fixed_decimal requires a representation of std::int32_t or std::int64_t");
+    static_assert(Scale >= 0 && Scale <= std::numeric_limits<Rep>::digits10, "The scale must fit in the representation");
+
+public:
+    using rep_type = Rep;
+
+    static constexpr int scale {Scale};
+
+private:
+    using unsigned_rep = detail::make_unsigned_t<Rep>;
+    using wide_type = detail::fixed_wide_type<Rep>;
+
+    static constexpr auto scale_factor() noexcept -> unsigned_rep
+    {
+        return detail::pow10(static_cast<unsigned_rep>(Scale));
+    }
+
+    Rep value_ {};
+
+public:
+    constexpr fixed_decimal() noexcept = default;
+
+    // val must be in range of the type
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_INTEGRAL Integer>
+    #else
+    template <typename Integer, std::enable_if_t<detail::is_integral_v<Integer>, bool> = true>
+    #endif
+    explicit constexpr fixed_decimal(const Integer val) noexcept : value_ {static_cast<Rep>(val) * static_cast<Rep>(scale_factor())} {}
+
+    // Rounds val to Scale digits in the current rounding mode.
+    // If val is NaN sets errno to EINVAL and the value is the maximum of the type.
+    // If it is out of range sets errno to ERANGE and the value is the maximum of the type with the sign of val.
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    #else
+    template <typename DecimalType, std::enable_if_t<detail::is_decimal_floating_point_v<DecimalType>, bool> = true>
+    #endif
+    explicit BOOST_DECIMAL_CXX20_CONSTEXPR fixed_decimal(const DecimalType val) noexcept
+    {
+        if (!detail::fixed_from_decimal<Scale>(val, value_))
+        {
+            detail::raise_status(status_flags::fe_dec_invalid);
+
+            #if defined(__clang__) && __clang_major__ >= 20
+            if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(val))
+            #endif
+            {
+                errno = isnan(val) ? EINVAL : ERANGE;
+            }
+
+            value_ = (std::numeric_limits<Rep>::max)();
+            if (!isnan(val) && signbit(val))
+            {
+                value_ = -value_;
+            }
+        }
+    }
+
+    // The value raw * 10^-Scale
+    static constexpr auto from_raw(const Rep raw) noexcept -> fixed_decimal
+    {
+        fixed_decimal res {};
+        res.value_ = raw;
+        return res;
+    }
+
+    constexpr auto raw() const noexcept -> Rep { return value_; }
+
+    // Exact if the type has enough digits, e.g. always for decimal128_t and for magnitudes of raw() below 10^16 for decimal64_t.
+    // Otherwise rounded in the current rounding mode.
+    #ifdef BOOST_DECIMAL_HAS_CONCEPTS
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+    #else
+    template <typename DecimalType, std::enable_if_t<detail::is_decimal_floating_point_v<DecimalType>, bool> = true>
+    #endif
+    explicit constexpr operator DecimalType() const noexcept
+    {
+        return DecimalType{detail::make_positive_unsigned(value_), -Scale, value_ < 0};
+    }
+
+    constexpr auto operator+() const noexcept -> fixed_decimal { return *this; }
+    constexpr auto operator-() const noexcept -> fixed_decimal { return from_raw(-value_); }
+
+    constexpr auto operator+=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        value_ += rhs.value_;
+        return *this;
+    }
+
+    constexpr auto operator-=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        value_ -= rhs.value_;
+        return *this;
+    }
+
+    constexpr auto operator*=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    constexpr auto operator/=(const fixed_decimal rhs) noexcept -> fixed_decimal&
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    friend constexpr auto operator+(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        return from_raw(lhs.value_ + rhs.value_);
+    }
+
+    friend constexpr auto operator-(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        return from_raw(lhs.value_ - rhs.value_);
+    }
+
+    // (lhs * rhs) / 10^Scale with the product in the wide type
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto operator*(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        const auto is_neg {(lhs.value_ < 0) != (rhs.value_ < 0)};
+        const auto lhs_sig {detail::make_positive_unsigned(lhs.value_)};
+        const auto rhs_sig {detail::make_positive_unsigned(rhs.value_)};
+
+        const auto product {static_cast<wide_type>(lhs_sig) * static_cast<wide_type>(rhs_sig)};
+        const auto res {detail::fixed_div_round_narrow<Rep>(product, static_cast<wide_type>(scale_factor()), is_neg)};
+        return from_raw(detail::fixed_apply_sign<Rep>(res, is_neg));
+    }
+
+    // (lhs * 10^Scale) / rhs with the dividend in the wide type.
+    // rhs must not be zero.
+    friend BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> fixed_decimal
+    {
+        BOOST_DECIMAL_ASSERT(rhs.value_ != 0);
+
+        const auto is_neg {(lhs.value_ < 0) != (rhs.value_ < 0)};
+        const auto dividend {static_cast<wide_type>(detail::make_positive_unsigned(lhs.value_)) * static_cast<wide_type>(scale_factor())};
+
+        const auto res {detail::fixed_div_round_narrow<Rep>(dividend, static_cast<wide_type>(detail::make_positive_unsigned(rhs.value_)), is_neg)};
+        return from_raw(detail::fixed_apply_sign<Rep>(res, is_neg));
+    }
+
+    friend constexpr auto operator==(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool { return lhs.value_ == rhs.value_; }
+    friend constexpr auto operator!=(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool { return lhs.value_ != rhs.value_; }
+    friend constexpr auto operator<(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool { return lhs.value_ < rhs.value_; }
+    friend constexpr auto operator<=(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool { return lhs.value_ <= rhs.value_; }
+    friend constexpr auto operator>(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool { return lhs.value_ > rhs.value_; }
+    friend constexpr auto operator>=(const fixed_decimal lhs, const fixed_decimal rhs) noexcept -> bool { return lhs.value_ >= rhs.value_; }
+};
+
+// Changes the number of digits after the decimal point, rounding in the current rounding mode if there are fewer.
+// The result must be in range of the type.
+BOOST_DECIMAL_EXPORT template <int NewScale, int Scale, typename Rep>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto rescale(const fixed_decimal<Scale, Rep> val) noexcept -> fixed_decimal<NewScale, Rep>
+{
+    using unsigned_rep = detail::make_unsigned_t<Rep>;
+
+    BOOST_DECIMAL_IF_CONSTEXPR (NewScale >= Scale)
+    {
+        constexpr auto factor {detail::pow10(static_cast<unsigned_rep>(NewScale >= Scale ? NewScale - Scale : 0))};
+        return fixed_decimal<NewScale, Rep>::from_raw(val.raw() * static_cast<Rep>(factor));
+    }
+    else
+    {
+        constexpr auto factor {detail::pow10(static_cast<unsigned_rep>(NewScale >= Scale ? 0 : Scale - NewScale))};
+        const auto is_neg {val.raw() < 0};
+        const auto res {detail::fixed_div_round(detail::make_positive_unsigned(val.raw()), factor, is_neg)};
+        return fixed_decimal<NewScale, Rep>::from_raw(detail::fixed_apply_sign<Rep>(res, is_neg));
+    }
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_FIXED_DECIMAL_HPP
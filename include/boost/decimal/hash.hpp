@@ -11,6 +11,7 @@
 #include <boost/decimal/decimal_fast32_t.hpp>
 #include <boost/decimal/decimal_fast64_t.hpp>
 #include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/fixed_decimal.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/cmath/normalize.hpp>
 
@@ -127,6 +128,16 @@ struct hash<boost::decimal::decimal_fast128_t>
 #  pragma GCC diagnostic pop
 #endif
 
+template <int Scale, typename Rep>
+struct hash<boost::decimal::fixed_decimal<Scale, Rep>>
+{
+    // Every value has exactly one representation so we can hash it directly
+    auto operator()(const boost::decimal::fixed_decimal<Scale, Rep>& v) const noexcept -> std::size_t
+    {
+        return std::hash<Rep>{}(v.raw());
+    }
+};
+
 } // namespace std
 
 #endif //BOOST_DECIMAL_HASH_HPP
@@ -0,0 +1,638 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_LAZY_EXPRESSION_HPP
+#define BOOST_DECIMAL_LAZY_EXPRESSION_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/promotion.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include <boost/decimal/detail/i256.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The significand of the intermediate results, which holds the exact product of two significands of the type
+template <typename DecimalType>
+using lazy_significand_type = std::conditional_t<(decimal_val_v<DecimalType> < 64), std::uint64_t,
+                              std::conditional_t<(decimal_val_v<DecimalType> < 128), int128::uint128_t, u256>>;
+
+// The number of decimal digits that always fit in T, e.g. 19 for std::uint64_t and 77 for u256
+template <typename T>
+constexpr auto lazy_digits_capacity() noexcept -> int
+{
+    return std::numeric_limits<T>::digits * 643 / 2136;
+}
+
+#ifdef __GNUC__
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wpadded"
+#endif
+
+// The unpacked value sig * 10^exp.
+// If sticky is set non-zero digits below sig were discarded, so the magnitude is slightly larger than sig * 10^exp.
+// If cancelled is set a subtraction left too few digits above the discarded ones for them to only decide the rounding.
+template <typename T>
+struct lazy_value
+{
+    T sig;
+    int exp;
+    bool sign;
+    bool sticky;
+    bool cancelled;
+};
+
+#ifdef __GNUC__
+#  pragma GCC diagnostic pop
+#endif
+
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto make_lazy_value(const T& sig, const int exp, const bool sign, const bool sticky, const bool cancelled) noexcept -> lazy_value<T>
+{
+    return {sig, exp, sign, sticky, cancelled};
+}
+
+// The digits a result with discarded digits needs for them to only decide the rounding:
+// the precision of the types whose intermediate results are held in T, and two more
+template <typename T>
+constexpr auto lazy_sticky_digits() noexcept -> int
+{
+    return (std::is_same<T, std::uint64_t>::value ? precision_v<decimal32_t> :
+            std::is_same<T, int128::uint128_t>::value ? precision_v<decimal64_t> : precision_v<decimal128_t>) + 2;
+}
+
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_is_zero(const lazy_value<T>& val) noexcept -> bool
+{
+    return val.sig == T{} && !val.sticky;
+}
+
+// Divides by 10^digits, in the narrowest type which holds the significand
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_divmod_pow10(const T sig, const int digits) noexcept -> impl::divmod_result<T>
+{
+    return impl::divmod(sig, pow10(static_cast<T>(digits)));
+}
+
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_divmod_pow10(const int128::uint128_t sig, const int digits) noexcept -> impl::divmod_result<int128::uint128_t>
+{
+    if (sig.high == 0U)
+    {
+        const auto div_res {lazy_divmod_pow10(sig.low, digits)};
+        return {int128::uint128_t{div_res.quotient}, int128::uint128_t{div_res.remainder}};
+    }
+
+    return impl::divmod_pow10(sig, digits, pow10(static_cast<int128::uint128_t>(digits)));
+}
+
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_divmod_pow10(const u256& sig, const int digits) noexcept -> impl::divmod_result<u256>
+{
+    if ((sig[3] | sig[2]) == 0U)
+    {
+        const auto div_res {lazy_divmod_pow10(static_cast<int128::uint128_t>(sig), digits)};
+        return {u256{div_res.quotient}, u256{div_res.remainder}};
+    }
+
+    return impl::divmod_pow10(sig, digits, pow10(static_cast<u256>(digits)));
+}
+
+// Removes the lowest digits of the significand, which has sig_digits digits
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_truncate(lazy_value<T>& val, const int digits, const int sig_digits) noexcept -> void
+{
+    val.exp += digits;
+
+    if (digits >= sig_digits)
+    {
+        val.sticky = val.sticky || val.sig != T{};
+        val.sig = T{};
+        return;
+    }
+
+    const auto div_res {lazy_divmod_pow10(val.sig, digits)};
+    val.sig = div_res.quotient;
+    val.sticky = val.sticky || div_res.remainder != T{};
+}
+
+// The exact products of the narrower significands, which are then truncated to the significand type
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_wide_product(const std::uint64_t lhs, const std::uint64_t rhs) noexcept -> int128::uint128_t
+{
+    return int128::uint128_t{lhs} * rhs;
+}
+
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_wide_product(const int128::uint128_t& lhs, const int128::uint128_t& rhs) noexcept -> u256
+{
+    // The significands of the operands themselves fit in 64 bits
+    if ((lhs.high | rhs.high) == 0U)
+    {
+        return u256{int128::uint128_t{lhs.low} * rhs.low};
+    }
+
+    return umul256(lhs, rhs);
+}
+
+// Sets res to |lhs - rhs| and returns whether rhs is larger
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_sub_significands(const u256& lhs, const u256& rhs, u256& res) noexcept -> bool
+{
+    return i256_sub(lhs, rhs, res);
+}
+
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_sub_significands(const T lhs, const T rhs, T& res) noexcept -> bool
+{
+    const bool borrow {lhs < rhs};
+    res = borrow ? static_cast<T>(rhs - lhs) : static_cast<T>(lhs - rhs);
+    return borrow;
+}
+
+// The number of bits of the significand, from which the number of digits is bounded without branches
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_bit_width(const std::uint64_t x) noexcept -> int
+{
+    return int128::bit_width(int128::uint128_t{x});
+}
+
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_bit_width(const int128::uint128_t& x) noexcept -> int
+{
+    return int128::bit_width(x);
+}
+
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_bit_width(const u256& x) noexcept -> int
+{
+    if (x[3] != 0U)
+    {
+        return 192 + int128::bit_width(int128::uint128_t{x[3]});
+    }
+    if (x[2] != 0U)
+    {
+        return 128 + int128::bit_width(int128::uint128_t{x[2]});
+    }
+
+    return int128::bit_width(int128::uint128_t{x[1], x[0]});
+}
+
+// 1233 / 4096 is slightly less than log10(2) and 1234 / 4096 slightly more,
+// so the bounds are either the number of digits or one away from it
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_digits_lower_bound(const T& x) noexcept -> int
+{
+    const int bits {lazy_bit_width(x)};
+    return bits == 0 ? 0 : (((bits - 1) * 1233) >> 12) + 1;
+}
+
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_digits_upper_bound(const T& x) noexcept -> int
+{
+    return ((lazy_bit_width(x) * 1234) >> 12) + 1;
+}
+
+// The significands are kept below 10^(max_digits - 1) so that a sum can not overflow
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_add(lazy_value<T> lhs, lazy_value<T> rhs) noexcept -> lazy_value<T>
+{
+    constexpr int max_digits {lazy_digits_capacity<T>() - 1};
+
+    if (lazy_is_zero(lhs))
+    {
+        if (lazy_is_zero(rhs))
+        {
+            // IEEE 754-2008 6.3: the sum of opposite-signed zeros is -0 only when rounding downward
+            const bool sign {lhs.sign == rhs.sign ? lhs.sign : current_rounding_mode() == rounding_mode::fe_dec_downward};
+            return {T{}, lhs.exp < rhs.exp ? lhs.exp : rhs.exp, sign, false, false};
+        }
+
+        return rhs;
+    }
+    if (lazy_is_zero(rhs))
+    {
+        return lhs;
+    }
+
+    // Align to the smaller exponent as far as the significand of the other operand allows,
+    // and discard the digits of the smaller operand which are still below that
+    if (lhs.exp < rhs.exp)
+    {
+        const auto temp {lhs};
+        lhs = rhs;
+        rhs = temp;
+    }
+
+    const int shift {lhs.exp - rhs.exp};
+    // The bound on the digits can be one more than the digits of the significand, which is then not scaled.
+    // Scaling a significand with discarded digits would put zeros in their place, so it is not scaled either.
+    // It already has nearly max_digits digits unless it is cancelled, when the result is not used.
+    const int room {lhs.sticky ? 0 : max_digits - lazy_digits_upper_bound(lhs.sig)};
+    const int scale_up {shift < room ? shift : (room > 0 ? room : 0)};
+
+    lhs.sig = lhs.sig * pow10(static_cast<T>(scale_up));
+    lhs.exp -= scale_up;
+
+    if (scale_up < shift)
+    {
+        lazy_truncate(rhs, shift - scale_up, num_digits(rhs.sig));
+    }
+
+    // The signs of the operands are random in general, so both the sum and the difference are computed
+    const bool subtract {lhs.sign != rhs.sign};
+    T difference {};
+    const bool rhs_larger {lazy_sub_significands(lhs.sig, rhs.sig, difference)};
+
+    lazy_value<T> res {subtract ? difference : static_cast<T>(lhs.sig + rhs.sig), lhs.exp,
+                       rhs_larger ? rhs.sign : lhs.sign, lhs.sticky || rhs.sticky, lhs.cancelled || rhs.cancelled};
+
+    if (subtract && res.sticky && num_digits(res.sig) < lazy_sticky_digits<T>())
+    {
+        // The leading digits cancelled, and the discarded digits below the few which remain can not be recovered.
+        // The expression is then evaluated with the operators.
+        res.cancelled = true;
+    }
+    else if (subtract && res.sig == T{})
+    {
+        // IEEE 754-2008 6.3: an exact difference of zero is -0 only when rounding downward
+        res.sign = current_rounding_mode() == rounding_mode::fe_dec_downward;
+    }
+    else if (subtract && (rhs_larger ? lhs.sticky && !rhs.sticky : rhs.sticky && !lhs.sticky))
+    {
+        // Only the discarded digits of the smaller operand are subtracted,
+        // so the magnitude is slightly less than res.sig
+        lazy_sub_significands(res.sig, T{1U}, res.sig);
+    }
+
+    if (res.sig >= pow10(static_cast<T>(max_digits)))
+    {
+        lazy_truncate(res, 1, max_digits + 1);
+    }
+
+    return res;
+}
+
+// A product with an exact zero is exactly zero, whatever was discarded from the other factor
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_product_sticky(const lazy_value<T>& lhs, const lazy_value<T>& rhs) noexcept -> bool
+{
+    return (lhs.sticky || rhs.sticky) && !lazy_is_zero(lhs) && !lazy_is_zero(rhs);
+}
+
+template <typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_mul(const lazy_value<T>& lhs, const lazy_value<T>& rhs) noexcept -> lazy_value<T>
+{
+    constexpr int max_digits {lazy_digits_capacity<T>() - 1};
+
+    auto res {make_lazy_value(lazy_wide_product(lhs.sig, rhs.sig), lhs.exp + rhs.exp, lhs.sign != rhs.sign,
+                              lazy_product_sticky(lhs, rhs), lhs.cancelled || rhs.cancelled)};
+    using wide_type = decltype(res.sig);
+
+    if (res.sig >= pow10(static_cast<wide_type>(max_digits)))
+    {
+        const int digits {num_digits(res.sig)};
+        lazy_truncate(res, digits - max_digits, digits);
+    }
+
+    return {static_cast<T>(res.sig), res.exp, res.sign, res.sticky, res.cancelled};
+}
+
+// There is no wider type for the significands of the 128-bit types.
+// When the exact product does not fit, the operands are truncated keeping at least half of the digits each.
+// The digits lost this way are far below those of the final rounding.
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_mul(lazy_value<u256> lhs, lazy_value<u256> rhs) noexcept -> lazy_value<u256>
+{
+    constexpr int product_digits {lazy_digits_capacity<u256>()};
+    constexpr int half_digits {product_digits / 2};
+
+    const int lhs_digits {num_digits(lhs.sig)};
+    const int rhs_digits {num_digits(rhs.sig)};
+
+    if (lhs_digits + rhs_digits > product_digits)
+    {
+        if (lhs_digits > half_digits && rhs_digits > half_digits)
+        {
+            lazy_truncate(lhs, lhs_digits - half_digits, lhs_digits);
+            lazy_truncate(rhs, rhs_digits - (product_digits - half_digits), rhs_digits);
+        }
+        else if (lhs_digits > rhs_digits)
+        {
+            lazy_truncate(lhs, lhs_digits + rhs_digits - product_digits, lhs_digits);
+        }
+        else
+        {
+            lazy_truncate(rhs, lhs_digits + rhs_digits - product_digits, rhs_digits);
+        }
+    }
+
+    // Products of significands which fit in 128 bits are a single multiplication
+    const auto sig {(lhs.sig[3] | lhs.sig[2] | rhs.sig[3] | rhs.sig[2]) == 0U ?
+                    umul256(static_cast<int128::uint128_t>(lhs.sig), static_cast<int128::uint128_t>(rhs.sig)) : lhs.sig * rhs.sig};
+
+    lazy_value<u256> res {sig, lhs.exp + rhs.exp, lhs.sign != rhs.sign, lazy_product_sticky(lhs, rhs), lhs.cancelled || rhs.cancelled};
+
+    if (res.sig >= pow10(static_cast<u256>(product_digits - 1)))
+    {
+        lazy_truncate(res, 1, product_digits);
+    }
+
+    return res;
+}
+
+// The only rounding of the expression.
+// The significand is first cut to one or two digits more than the precision of the type,
+// using an estimate of the number of digits which is at most one too small.
+// A significand with discarded digits has at least two digits more than the precision unless it is cancelled,
+// so a shorter one is exact.
+template <typename DecimalType, typename T>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto lazy_round(lazy_value<T> val) noexcept -> DecimalType
+{
+    using sig_type = std::conditional_t<(decimal_val_v<DecimalType> < 128), std::uint64_t, int128::uint128_t>;
+
+    constexpr int target_digits {precision_v<DecimalType> + 1};
+
+    const int min_digits {lazy_digits_lower_bound(val.sig)};
+
+    if (min_digits > target_digits)
+    {
+        const int digits {min_digits - target_digits};
+        const auto div_res {lazy_divmod_pow10(val.sig, digits)};
+        val.sig = div_res.quotient;
+        val.exp += digits;
+        val.sticky = val.sticky || div_res.remainder != T{};
+    }
+
+    auto sig {static_cast<sig_type>(val.sig)};
+
+    // The significand has at most two digits too many, and if it has any it also holds every non-zero discarded digit
+    const int extra_digits {static_cast<int>(sig >= pow10(static_cast<sig_type>(target_digits))) +
+                            static_cast<int>(sig >= pow10(static_cast<sig_type>(target_digits - 1)))};
+
+    if (extra_digits == 0)
+    {
+        return DecimalType{sig, val.exp, val.sign};
+    }
+
+    // Results in the normal range are rounded here without branching on the digits, and the constructor only encodes them.
+    // Subnormal results are rounded by the constructor instead, so a last digit of 0 or 5 is moved up by one
+    // if anything was discarded, which makes it round the same as the exact value.
+    if (is_fast_type_v<DecimalType> || val.exp + extra_digits + bias_v<DecimalType> >= 0)
+    {
+        const auto divisor {pow10(static_cast<sig_type>(extra_digits))};
+        const auto half {static_cast<sig_type>(divisor / 2U)};
+        const auto quotient {static_cast<sig_type>(sig / divisor)};
+        const auto remainder {static_cast<sig_type>(sig - quotient * divisor)};
+
+        const bool inexact {remainder != 0U || val.sticky};
+        if (inexact)
+        {
+            raise_status(status_flags::fe_dec_inexact);
+        }
+
+        bool round_up {};
+        switch (current_rounding_mode())
+        {
+            case rounding_mode::fe_dec_to_nearest:
+                round_up = (remainder > half) | ((remainder == half) & (val.sticky | (static_cast<std::uint64_t>(quotient % 2U) == 1U)));
+                break;
+            case rounding_mode::fe_dec_to_nearest_from_zero:
+                round_up = remainder >= half;
+                break;
+            case rounding_mode::fe_dec_upward:
+                round_up = inexact & !val.sign;
+                break;
+            case rounding_mode::fe_dec_downward:
+                round_up = inexact & val.sign;
+                break;
+            default:
+                break;
+        }
+
+        return DecimalType{static_cast<sig_type>(quotient + static_cast<sig_type>(round_up)), val.exp + extra_digits, val.sign};
+    }
+
+    if (val.sticky)
+    {
+        const auto last_digit {sig % 10U};
+        if (last_digit == 0U || last_digit == 5U)
+        {
+            ++sig;
+        }
+    }
+
+    return DecimalType{sig, val.exp, val.sign};
+}
+
+// The nodes of the expression tree.
+// Each can be evaluated with the operators of the type, which is used for non-finite operands,
+// or exactly in the unpacked form.
+
+template <typename DecimalType>
+struct lazy_terminal
+{
+    using sig_type = lazy_significand_type<DecimalType>;
+
+    DecimalType value;
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto finite() const noexcept -> bool { return isfinite(value); }
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto eager() const noexcept -> DecimalType { return value; }
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto wide() const noexcept -> lazy_value<sig_type>
+    {
+        const auto components {get_components(value)};
+        return {sig_type{components.sig}, static_cast<int>(components.exp), components.sign, false, false};
+    }
+};
+
+template <typename Node>
+struct lazy_negate
+{
+    Node node;
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto finite() const noexcept -> bool { return node.finite(); }
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto eager() const noexcept { return -node.eager(); }
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto wide() const noexcept
+    {
+        auto res {node.wide()};
+        res.sign = !res.sign;
+        return res;
+    }
+};
+
+struct lazy_plus
+{
+    template <typename T>
+    static BOOST_DECIMAL_CUDA_CONSTEXPR auto eager(const T lhs, const T rhs) noexcept -> T { return lhs + rhs; }
+
+    template <typename T>
+    static BOOST_DECIMAL_CUDA_CONSTEXPR auto wide(const lazy_value<T>& lhs, const lazy_value<T>& rhs) noexcept -> lazy_value<T> { return lazy_add(lhs, rhs); }
+};
+
+struct lazy_minus
+{
+    template <typename T>
+    static BOOST_DECIMAL_CUDA_CONSTEXPR auto eager(const T lhs, const T rhs) noexcept -> T { return lhs - rhs; }
+
+    template <typename T>
+    static BOOST_DECIMAL_CUDA_CONSTEXPR auto wide(const lazy_value<T>& lhs, lazy_value<T> rhs) noexcept -> lazy_value<T>
+    {
+        rhs.sign = !rhs.sign;
+        return lazy_add(lhs, rhs);
+    }
+};
+
+struct lazy_multiplies
+{
+    template <typename T>
+    static BOOST_DECIMAL_CUDA_CONSTEXPR auto eager(const T lhs, const T rhs) noexcept -> T { return lhs * rhs; }
+
+    template <typename T>
+    static BOOST_DECIMAL_CUDA_CONSTEXPR auto wide(const lazy_value<T>& lhs, const lazy_value<T>& rhs) noexcept -> lazy_value<T> { return lazy_mul(lhs, rhs); }
+};
+
+template <typename Op, typename Lhs, typename Rhs>
+struct lazy_binary
+{
+    Lhs lhs;
+    Rhs rhs;
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto finite() const noexcept -> bool { return lhs.finite() && rhs.finite(); }
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto eager() const noexcept { return Op::eager(lhs.eager(), rhs.eager()); }
+
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto wide() const noexcept { return Op::wide(lhs.wide(), rhs.wide()); }
+};
+
+} // namespace detail
+
+// An expression of +, - and * which is evaluated in unpacked integers and rounded once,
+// when it is converted to DecimalType or evaluate() is called.
+// The operands are held by value, so the expression can outlive them.
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Node = detail::lazy_terminal<DecimalType>>
+class lazy_expression
+{
+    Node node_;
+
+public:
+    using value_type = DecimalType;
+
+    explicit constexpr lazy_expression(const Node& node) noexcept : node_ {node} {}
+
+    // The expression tree, for use by the operators
+    constexpr auto node() const noexcept -> const Node& { return node_; }
+
+    // Non-finite operands, and results whose discarded digits were exposed by a cancellation,
+    // are evaluated with the operators of the type
+    BOOST_DECIMAL_CUDA_CONSTEXPR auto evaluate() const noexcept -> DecimalType
+    {
+        #ifndef BOOST_DECIMAL_FAST_MATH
+        if (!node_.finite())
+        {
+            return node_.eager();
+        }
+        #endif
+
+        const auto val {node_.wide()};
+        if (BOOST_DECIMAL_UNLIKELY(val.cancelled))
+        {
+            return node_.eager();
+        }
+
+        return detail::lazy_round<DecimalType>(val);
+    }
+
+    explicit BOOST_DECIMAL_CUDA_CONSTEXPR operator DecimalType() const noexcept { return evaluate(); }
+};
+
+#ifdef BOOST_DECIMAL_HAS_CONCEPTS
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType>
+#else
+BOOST_DECIMAL_EXPORT template <typename DecimalType, std::enable_if_t<detail::is_decimal_floating_point_v<DecimalType>, bool> = true>
+#endif
+constexpr auto lazy(const DecimalType val) noexcept -> lazy_expression<DecimalType>
+{
+    return lazy_expression<DecimalType>{detail::lazy_terminal<DecimalType>{val}};
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Node>
+constexpr auto operator+(const lazy_expression<DecimalType, Node>& val) noexcept -> lazy_expression<DecimalType, Node>
+{
+    return val;
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Node>
+constexpr auto operator-(const lazy_expression<DecimalType, Node>& val) noexcept
+{
+    using node_type = detail::lazy_negate<Node>;
+    return lazy_expression<DecimalType, node_type>{node_type{val.node()}};
+}
+
+#define BOOST_DECIMAL_LAZY_BINARY_OPERATOR(op, tag)                                                                                          \
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs, typename Rhs>                                                             \
+constexpr auto operator op(const lazy_expression<DecimalType, Lhs>& lhs, const lazy_expression<DecimalType, Rhs>& rhs) noexcept            \
+{                                                                                                                                            \
+    using node_type = detail::lazy_binary<detail::tag, Lhs, Rhs>;                                                                            \
+    return lazy_expression<DecimalType, node_type>{node_type{lhs.node(), rhs.node()}};                                                       \
+}                                                                                                                                            \
+                                                                                                                                             \
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs>                                                                           \
+constexpr auto operator op(const lazy_expression<DecimalType, Lhs>& lhs, const DecimalType rhs) noexcept                                     \
+{                                                                                                                                            \
+    return lhs op lazy(rhs);                                                                                                                 \
+}                                                                                                                                            \
+                                                                                                                                             \
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Rhs>                                                                           \
+constexpr auto operator op(const DecimalType lhs, const lazy_expression<DecimalType, Rhs>& rhs) noexcept                                     \
+{                                                                                                                                            \
+    return lazy(lhs) op rhs;                                                                                                                 \
+}
+
+BOOST_DECIMAL_LAZY_BINARY_OPERATOR(+, lazy_plus)
+BOOST_DECIMAL_LAZY_BINARY_OPERATOR(-, lazy_minus)
+BOOST_DECIMAL_LAZY_BINARY_OPERATOR(*, lazy_multiplies)
+
+#undef BOOST_DECIMAL_LAZY_BINARY_OPERATOR
+
+// Division is rounded like the operator of the type, and the quotient is an operand of the rest of the expression
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs, typename Rhs>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const lazy_expression<DecimalType, Lhs>& lhs, const lazy_expression<DecimalType, Rhs>& rhs) noexcept
+    -> lazy_expression<DecimalType>
+{
+    return lazy(lhs.evaluate() / rhs.evaluate());
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Lhs>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const lazy_expression<DecimalType, Lhs>& lhs, const DecimalType rhs) noexcept -> lazy_expression<DecimalType>
+{
+    return lazy(lhs.evaluate() / rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType, typename Rhs>
+BOOST_DECIMAL_CUDA_CONSTEXPR auto operator/(const DecimalType lhs, const lazy_expression<DecimalType, Rhs>& rhs) noexcept -> lazy_expression<DecimalType>
+{
+    return lazy(lhs / rhs.evaluate());
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_LAZY_EXPRESSION_HPP
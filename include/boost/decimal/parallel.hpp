@@ -0,0 +1,168 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_PARALLEL_HPP
+#define BOOST_DECIMAL_PARALLEL_HPP
+
+#include <boost/decimal/decimal_accumulator.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <atomic>
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+#include <span>
+#endif
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The input is split into chunks of this many elements regardless of the number of threads,
+// so the partial sums, and the order in which they are merged, only depend on the input
+BOOST_DECIMAL_INLINE_CONSTEXPR_VARIABLE std::size_t parallel_chunk_size {65536U};
+
+// Calls reduce_chunk(acc, first, count) for each chunk on up to threads threads,
+// merges the partial sums in chunk order and rounds the total once
+template <typename DecimalType, typename ReduceChunk>
+auto parallel_reduce(const std::size_t n, unsigned threads, ReduceChunk reduce_chunk) -> DecimalType
+{
+    const auto chunks {(n + parallel_chunk_size - 1U) / parallel_chunk_size};
+    if (chunks == 0U)
+    {
+        return decimal_accumulator<DecimalType>{}.result();
+    }
+
+    if (threads == 0U)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0U)
+    {
+        threads = 1U;
+    }
+    if (threads > chunks)
+    {
+        threads = static_cast<unsigned>(chunks);
+    }
+
+    std::vector<decimal_accumulator<DecimalType>> partials(chunks);
+    std::atomic<std::size_t> next_chunk {0U};
+
+    const auto worker = [&]()
+    {
+        for (auto chunk {next_chunk.fetch_add(1U, std::memory_order_relaxed)}; chunk < chunks;
+             chunk = next_chunk.fetch_add(1U, std::memory_order_relaxed))
+        {
+            const auto first {chunk * parallel_chunk_size};
+            const auto count {n - first < parallel_chunk_size ? n - first : parallel_chunk_size};
+
+            // Accumulate locally so that neighbouring partials are not written concurrently
+            decimal_accumulator<DecimalType> acc {};
+            reduce_chunk(acc, first, count);
+            partials[chunk] = acc;
+        }
+    };
+
+    // The calling thread works on chunks as well, so threads - 1 additional threads are started
+    std::vector<std::thread> workers {};
+    workers.reserve(threads - 1U);
+
+    #ifndef BOOST_DECIMAL_DISABLE_EXCEPTIONS
+    try
+    {
+    #endif
+        for (unsigned i {1U}; i < threads; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+    #ifndef BOOST_DECIMAL_DISABLE_EXCEPTIONS
+    }
+    catch (const std::system_error&) // NOLINT(bugprone-empty-catch)
+    {
+        // Continue with the threads that were started
+    }
+    #endif
+
+    worker();
+
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+
+    for (std::size_t chunk {1U}; chunk < chunks; ++chunk)
+    {
+        partials[0].merge(partials[chunk]);
+    }
+
+    return partials[0].result();
+}
+
+} // namespace detail
+
+// Returns the sum of values[i] for i in [0, n), rounded once, computed on up to threads threads.
+// A value of 0 for threads uses std::thread::hardware_concurrency().
+// The result does not depend on the number of threads or on how the work was scheduled.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto parallel_sum(const DecimalType* values, const std::size_t n, const unsigned threads = 0U)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::parallel_reduce<DecimalType>(n, threads,
+        [values](decimal_accumulator<DecimalType>& acc, const std::size_t first, const std::size_t count)
+        {
+            acc.accumulate(values + first, count);
+        });
+}
+
+// Returns the sum of a[i] * b[i] for i in [0, n), rounded once, computed on up to threads threads
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+auto parallel_dot(const DecimalType* a, const DecimalType* b, const std::size_t n, const unsigned threads = 0U)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::parallel_reduce<DecimalType>(n, threads,
+        [a, b](decimal_accumulator<DecimalType>& acc, const std::size_t first, const std::size_t count)
+        {
+            acc.accumulate_products(a + first, b + first, count);
+        });
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// values, a and b are contiguous ranges of DecimalType, such as std::vector<DecimalType> or std::span<DecimalType>,
+// and DecimalType is deduced from the first range
+BOOST_DECIMAL_EXPORT template <typename Range, typename DecimalType = detail::contiguous_range_value_t<Range>>
+auto parallel_sum(const Range& values, const unsigned threads = 0U)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    const std::span<const DecimalType> span_values(values);
+    return parallel_sum(span_values.data(), span_values.size(), threads);
+}
+
+// The sizes must be equal, as asserted in debug builds.
+// If they are not, only the smaller of them is processed, so that no range is accessed past its end.
+BOOST_DECIMAL_EXPORT template <typename RangeA, typename RangeB, typename DecimalType = detail::contiguous_range_value_t<RangeA>>
+auto parallel_dot(const RangeA& a, const RangeB& b, const unsigned threads = 0U)
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    const std::span<const DecimalType> span_a(a);
+    const std::span<const DecimalType> span_b(b);
+
+    BOOST_DECIMAL_ASSERT(span_a.size() == span_b.size());
+    return parallel_dot(span_a.data(), span_b.data(), span_a.size() < span_b.size() ? span_a.size() : span_b.size(), threads);
+}
+
+#endif
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_PARALLEL_HPP
@@ -0,0 +1,327 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_ROUNDED_DECIMAL_HPP
+#define BOOST_DECIMAL_ROUNDED_DECIMAL_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/cfenv.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/normalize.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
+#include <boost/decimal/detail/mul_impl.hpp>
+#include <boost/decimal/detail/div_impl.hpp>
+#include <boost/decimal/detail/u256.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// The finite paths of operator+, operator* and operator/ for each type with the result rounded in Mode.
+// They are the same paths the operators take, so with the same mode the results are identical.
+
+// Same quantum operands in the small significand encoding are summed on the words, as in the operators.
+// That sum is exact, so it does not depend on the rounding mode.
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_add(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value || std::is_same<DecimalType, decimal64_t>::value, DecimalType>
+{
+    using bits_type = std::conditional_t<std::is_same<DecimalType, decimal32_t>::value, std::uint32_t, std::uint64_t>;
+    constexpr auto significand_mask {static_cast<bits_type>(std::is_same<DecimalType, decimal32_t>::value ? d32_not_11_significand_mask : d64_not_11_significand_mask)};
+
+    bits_type bits {};
+    if (bid_same_quantum_add<bits_type, significand_mask>(to_bits(lhs), to_bits(rhs), bits))
+    {
+        return from_bits(bits);
+    }
+
+    auto lhs_components {get_components(lhs)};
+    expand_significand<DecimalType>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {get_components(rhs)};
+    expand_significand<DecimalType>(rhs_components.sig, rhs_components.exp);
+
+    return add_impl<DecimalType, Mode>(lhs_components, rhs_components);
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_add(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value, DecimalType>
+{
+    return d128_add_impl_narrow<DecimalType, Mode>(get_components(lhs), get_components(rhs));
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_add(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast32_t>::value || std::is_same<DecimalType, decimal_fast64_t>::value, DecimalType>
+{
+    return add_impl<DecimalType, Mode>(get_components(lhs), get_components(rhs));
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_add(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast128_t>::value, DecimalType>
+{
+    return d128_add_impl_new<DecimalType, Mode>(get_components(lhs), get_components(rhs));
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_mul(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value || std::is_same<DecimalType, decimal64_t>::value ||
+                        std::is_same<DecimalType, decimal_fast32_t>::value, DecimalType>
+{
+    return mul_impl<DecimalType, Mode>(get_components(lhs), get_components(rhs));
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_mul(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast64_t>::value, DecimalType>
+{
+    return d64_mul_impl<DecimalType, Mode>(get_components(lhs), get_components(rhs));
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_mul(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value || std::is_same<DecimalType, decimal_fast128_t>::value, DecimalType>
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    return d128_mul_impl<DecimalType, Mode>(x.sig, x.exp, x.sign, y.sig, y.exp, y.sign);
+}
+
+// The division paths require both operands to be non-zero
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_div(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal32_t>::value, DecimalType>
+{
+    auto lhs_components {get_components(lhs)};
+    expand_significand<DecimalType>(lhs_components.sig, lhs_components.exp);
+    auto rhs_components {get_components(rhs)};
+    expand_significand<DecimalType>(rhs_components.sig, rhs_components.exp);
+
+    return generic_div_impl<DecimalType, Mode>(lhs_components, rhs_components);
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_div(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast32_t>::value, DecimalType>
+{
+    return generic_div_impl<DecimalType, Mode>(get_components(lhs), get_components(rhs));
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_div(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal64_t>::value || std::is_same<DecimalType, decimal_fast64_t>::value, DecimalType>
+{
+    // The operators only expand the dividend, which for the fast type is already normalized
+    auto lhs_components {get_components(lhs)};
+    expand_significand<DecimalType>(lhs_components.sig, lhs_components.exp);
+    const auto rhs_components {get_components(rhs)};
+
+    return d64_generic_div_impl<DecimalType, Mode>(lhs_components, rhs_components, lhs_components.sign != rhs_components.sign);
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_div(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal128_t>::value, DecimalType>
+{
+    auto lhs_components {get_components(lhs)};
+    expand_significand<DecimalType>(lhs_components.sig, lhs_components.exp);
+
+    decimal128_t_components q_components {};
+    d128_generic_div_impl(lhs_components, get_components(rhs), q_components);
+
+    return make_rounded<DecimalType, Mode>(q_components.sig, q_components.exp, q_components.sign);
+}
+
+template <rounding_mode Mode, typename DecimalType>
+constexpr auto rounded_div(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<std::is_same<DecimalType, decimal_fast128_t>::value, DecimalType>
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    constexpr auto ten_pow_precision {pow10(int128::uint128_t(precision_v<DecimalType>))};
+    const auto big_sig_lhs {umul256(x.sig, ten_pow_precision)};
+    const auto res_sig {big_sig_lhs / y.sig};
+    const auto res_exp {x.exp - y.exp - precision_v<DecimalType>};
+
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+    if (big_sig_lhs % y.sig != u256{})
+    {
+        raise_status(status_flags::fe_dec_inexact);
+    }
+    #endif
+
+    return make_rounded<DecimalType, Mode>(static_cast<int128::uint128_t>(res_sig), res_exp, x.sign != y.sign);
+}
+
+} // namespace detail
+
+// lhs + rhs, lhs - rhs, lhs * rhs and lhs / rhs rounded in Mode rather than in the current rounding mode.
+// Since the mode is known at compile time the dispatch on it folds away,
+// so each directed mode costs the same as the default one.
+// The results are identical to those of the operators with Mode as the current rounding mode.
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode, typename DecimalType>
+constexpr auto add(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    // Non-finite results are never rounded
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return lhs + rhs;
+    }
+    #endif
+
+    return detail::rounded_add<Mode>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode, typename DecimalType>
+constexpr auto sub(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return lhs - rhs;
+    }
+    #endif
+
+    // a - b = a + (-b)
+    return detail::rounded_add<Mode>(lhs, -rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode, typename DecimalType>
+constexpr auto mul(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs))
+    {
+        return lhs * rhs;
+    }
+    #endif
+
+    return detail::rounded_mul<Mode>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <rounding_mode Mode, typename DecimalType>
+constexpr auto div(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    // Division by zero and a zero dividend give exact results as well
+    #ifndef BOOST_DECIMAL_FAST_MATH
+    if (!isfinite(lhs) || !isfinite(rhs) || detail::get_components(lhs).sig == 0U || detail::get_components(rhs).sig == 0U)
+    #else
+    if (detail::get_components(lhs).sig == 0U || detail::get_components(rhs).sig == 0U)
+    #endif
+    {
+        return lhs / rhs;
+    }
+
+    return detail::rounded_div<Mode>(lhs, rhs);
+}
+
+// A decimal type whose arithmetic operators round in Mode, fixed at compile time,
+// regardless of the current rounding mode
+BOOST_DECIMAL_EXPORT template <typename DecimalType, rounding_mode Mode>
+class rounded_decimal
+{
+    static_assert(detail::is_decimal_floating_point_v<DecimalType>, "rounded_decimal requires a decimal floating point type");
+
+public:
+    using value_type = DecimalType;
+
+private:
+    DecimalType value_ {};
+
+public:
+    constexpr rounded_decimal() noexcept = default;
+
+    // Implicit so that plain values can be mixed with rounded ones
+    constexpr rounded_decimal(const DecimalType value) noexcept : value_ {value} {}
+
+    constexpr auto value() const noexcept -> DecimalType { return value_; }
+
+    explicit constexpr operator DecimalType() const noexcept { return value_; }
+
+    static constexpr auto rounding() noexcept -> rounding_mode { return Mode; }
+
+    constexpr auto operator+() const noexcept -> rounded_decimal { return *this; }
+    constexpr auto operator-() const noexcept -> rounded_decimal { return rounded_decimal{-value_}; }
+
+    constexpr auto operator+=(const rounded_decimal rhs) noexcept -> rounded_decimal&
+    {
+        value_ = add<Mode>(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator-=(const rounded_decimal rhs) noexcept -> rounded_decimal&
+    {
+        value_ = sub<Mode>(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator*=(const rounded_decimal rhs) noexcept -> rounded_decimal&
+    {
+        value_ = mul<Mode>(value_, rhs.value_);
+        return *this;
+    }
+
+    constexpr auto operator/=(const rounded_decimal rhs) noexcept -> rounded_decimal&
+    {
+        value_ = div<Mode>(value_, rhs.value_);
+        return *this;
+    }
+
+    friend constexpr auto operator+(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> rounded_decimal
+    {
+        return rounded_decimal{add<Mode>(lhs.value_, rhs.value_)};
+    }
+
+    friend constexpr auto operator-(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> rounded_decimal
+    {
+        return rounded_decimal{sub<Mode>(lhs.value_, rhs.value_)};
+    }
+
+    friend constexpr auto operator*(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> rounded_decimal
+    {
+        return rounded_decimal{mul<Mode>(lhs.value_, rhs.value_)};
+    }
+
+    friend constexpr auto operator/(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> rounded_decimal
+    {
+        return rounded_decimal{div<Mode>(lhs.value_, rhs.value_)};
+    }
+
+    friend constexpr auto operator==(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> bool { return lhs.value_ == rhs.value_; }
+    friend constexpr auto operator!=(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> bool { return lhs.value_ != rhs.value_; }
+    friend constexpr auto operator<(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> bool { return lhs.value_ < rhs.value_; }
+    friend constexpr auto operator<=(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> bool { return lhs.value_ <= rhs.value_; }
+    friend constexpr auto operator>(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> bool { return lhs.value_ > rhs.value_; }
+    friend constexpr auto operator>=(const rounded_decimal lhs, const rounded_decimal rhs) noexcept -> bool { return lhs.value_ >= rhs.value_; }
+};
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_ROUNDED_DECIMAL_HPP
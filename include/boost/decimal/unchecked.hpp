@@ -0,0 +1,195 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_UNCHECKED_HPP
+#define BOOST_DECIMAL_UNCHECKED_HPP
+
+#include <boost/decimal/decimal32_t.hpp>
+#include <boost/decimal/decimal64_t.hpp>
+#include <boost/decimal/decimal128_t.hpp>
+#include <boost/decimal/decimal_fast32_t.hpp>
+#include <boost/decimal/decimal_fast64_t.hpp>
+#include <boost/decimal/decimal_fast128_t.hpp>
+#include <boost/decimal/rounded_decimal.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/components.hpp>
+#include <boost/decimal/detail/comparison.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include "detail/int128.hpp"
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+template <typename DecimalType>
+constexpr auto unchecked_equal_impl(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<is_ieee_type_v<DecimalType>, bool>
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    return equal_parts_impl<DecimalType>(x.sig, x.exp, x.sign, y.sig, y.exp, y.sign);
+}
+
+// The fast types are always normalized, so equal values have the same representation
+template <typename DecimalType>
+constexpr auto unchecked_equal_impl(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<is_fast_type_v<DecimalType>, bool>
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    if (x.sig == 0U && y.sig == 0U)
+    {
+        // -0 == +0
+        return true;
+    }
+
+    return x.sig == y.sig && x.exp == y.exp && x.sign == y.sign;
+}
+
+// The same paths the operators take once the operands are known to be finite
+template <typename DecimalType>
+constexpr auto unchecked_less_impl(const DecimalType lhs, const DecimalType rhs) noexcept
+    -> std::enable_if_t<is_ieee_type_v<DecimalType> && decimal_val_v<DecimalType> < 128, bool>
+{
+    return sequential_less_impl(lhs, rhs);
+}
+
+template <typename DecimalType>
+constexpr auto unchecked_less_impl(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<is_ieee_type_v<DecimalType> && decimal_val_v<DecimalType> == 128, bool>
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    return less_parts_impl<DecimalType>(x.sig, x.exp, x.sign, y.sig, y.exp, y.sign);
+}
+
+template <typename DecimalType>
+constexpr auto unchecked_less_impl(const DecimalType& lhs, const DecimalType& rhs) noexcept
+    -> std::enable_if_t<is_fast_type_v<DecimalType>, bool>
+{
+    const auto x {get_components(lhs)};
+    const auto y {get_components(rhs)};
+
+    return fast_type_less_parts_impl(x.sig, x.exp, x.sign, y.sig, y.exp, y.sign);
+}
+
+} // namespace detail
+
+// lhs + rhs, lhs - rhs, lhs * rhs and lhs / rhs for operands which are known to be finite.
+// The classification of NaN and infinity done by the operators is skipped,
+// so the results for finite operands are identical to those of the operators,
+// and the results for non-finite operands are unspecified.
+// Results which overflow are still infinite.
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto unchecked_add(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::rounded_add<detail::runtime_rounding_mode>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto unchecked_sub(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    // a - b = a + (-b)
+    return detail::rounded_add<detail::runtime_rounding_mode>(lhs, -rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto unchecked_mul(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    return detail::rounded_mul<detail::runtime_rounding_mode>(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto unchecked_div(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, DecimalType)
+{
+    // Zeros are finite, so a zero dividend or divisor is still handled like the operator does
+    if (detail::get_components(lhs).sig == 0U || detail::get_components(rhs).sig == 0U)
+    {
+        return lhs / rhs;
+    }
+
+    return detail::rounded_div<detail::runtime_rounding_mode>(lhs, rhs);
+}
+
+// lhs == rhs and lhs < rhs for operands which are known to be finite
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto unchecked_equal(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, bool)
+{
+    return detail::unchecked_equal_impl(lhs, rhs);
+}
+
+BOOST_DECIMAL_EXPORT template <typename DecimalType>
+constexpr auto unchecked_less(const DecimalType lhs, const DecimalType rhs) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, DecimalType, bool)
+{
+    return detail::unchecked_less_impl(lhs, rhs);
+}
+
+#ifdef _MSC_VER
+#  pragma warning(push)
+#  pragma warning(disable: 4146)
+#endif
+
+// Truncates val towards zero like static_cast<TargetType>(val).
+// val must be finite, and the truncated value must be representable in TargetType.
+// Unlike the conversion operators neither is checked, and errno is never set.
+BOOST_DECIMAL_EXPORT template <typename TargetType, typename DecimalType>
+constexpr auto unchecked_to_integral(const DecimalType val) noexcept
+    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, DecimalType, detail::is_integral_v, TargetType, TargetType)
+{
+    using conversion_type = std::conditional_t<(std::numeric_limits<TargetType>::digits > 64 || detail::decimal_val_v<DecimalType> >= 128),
+                                               int128::uint128_t, std::uint64_t>;
+
+    const auto components {detail::get_components(val)};
+    const auto exp {static_cast<int>(components.exp)};
+
+    auto result {static_cast<conversion_type>(components.sig)};
+
+    if (exp > 0)
+    {
+        result *= detail::pow10(static_cast<conversion_type>(exp));
+    }
+    else if (exp < 0)
+    {
+        if (-exp > std::numeric_limits<conversion_type>::digits10)
+        {
+            return static_cast<TargetType>(0);
+        }
+
+        result /= detail::pow10(static_cast<conversion_type>(-exp));
+    }
+
+    if (components.sign)
+    {
+        result = -result;
+    }
+
+    return static_cast<TargetType>(result);
+}
+
+#ifdef _MSC_VER
+#  pragma warning(pop)
+#endif
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_UNCHECKED_HPP
@@ -31,7 +31,9 @@ module;
 #include <compare>
 #include <charconv>
 #include <string_view>
+#include <span>
 #include <string>
+#include <vector>
 
 // <stdfloat> is a C++23 feature that is not everywhere yet
 #if __has_include(<stdfloat>)
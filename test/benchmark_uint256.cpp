@@ -8,6 +8,7 @@
 
 #include <boost/decimal/detail/u256.hpp>
 #include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/invariant_div.hpp>
 #include <chrono>
 #include <random>
 #include <vector>
@@ -17,6 +18,7 @@
 #include <cmath>
 #include <cstring>
 #include <functional>
+#include <limits>
 
 constexpr unsigned N = 20'000'000;
 constexpr unsigned K = 5;
@@ -61,7 +63,7 @@ std::vector<detail::u256> generate_random_vector_new(std::size_t size = N, unsig
     for (std::size_t i = 0; i < size; ++i)
     {
         auto current_words = words;
-        BOOST_INT128_IF_CONSTEXPR (words == 5)
+        BOOST_DECIMAL_IF_CONSTEXPR (words == 5)
         {
             // Alternating 4/2
             current_words = i % 2 == 0 ? 4 : 2;
@@ -95,6 +97,42 @@ std::vector<detail::u256> generate_random_vector_new(std::size_t size = N, unsig
     return result;
 }
 
+template <typename T>
+T narrow_u256(const detail::u256& val)
+{
+    return static_cast<T>(static_cast<boost::int128::uint128_t>(val));
+}
+
+template <>
+detail::u256 narrow_u256<detail::u256>(const detail::u256& val)
+{
+    return val;
+}
+
+// Uniformly distributed bits put almost every value at the top of the digit range,
+// so these draw the number of digits uniformly from [1, max_digits] instead
+template <typename T>
+std::vector<T> generate_uniform_digits_vector(const int max_digits, std::size_t size = N / 10U, unsigned seed = 42U)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<int> digits_dist(1, max_digits);
+
+    std::vector<T> result(size);
+    for (auto& val : result)
+    {
+        const auto digits = digits_dist(gen);
+        const auto lower = detail::pow10_256(static_cast<std::size_t>(digits - 1));
+        const auto span = detail::pow10_256(static_cast<std::size_t>(digits)) - lower;
+
+        const detail::u256 random_bits {gen(), gen(), gen(), gen()};
+        const detail::u256 current {lower + random_bits % span};
+
+        val = narrow_u256<T>(current);
+    }
+
+    return result;
+}
+
 template <typename T>
 BOOST_DECIMAL_NO_INLINE void test_comparisons(const std::vector<T>& data_vec, const char* label)
 {
@@ -205,27 +243,6 @@ BOOST_DECIMAL_NO_INLINE void test_umul256(const std::vector<T>& data_vec, const
     std::cout << "umul<" << std::left << std::setw(11) << label << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
-template <typename T>
-BOOST_DECIMAL_NO_INLINE void test_umul256_new(const std::vector<T>& data_vec, const char* label)
-{
-    const auto t1 = std::chrono::steady_clock::now();
-    std::size_t s = 0; // discard variable
-
-    for (std::size_t k {}; k < K; ++k)
-    {
-        for (std::size_t i {}; i < data_vec.size() - 1U; ++i)
-        {
-            const auto val1 = static_cast<boost::int128::uint128_t>(data_vec[i]);
-            const auto val2 = static_cast<boost::int128::uint128_t>(data_vec[i + 1]);
-            s += static_cast<std::size_t>(boost::decimal::detail::umul256_new(val1, val2));
-        }
-    }
-
-    const auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "umul<" << std::left << std::setw(11) << label << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
-}
-
 int main()
 {
     using namespace boost::decimal::detail;
@@ -246,8 +263,26 @@ int main()
 
         std::cout << std::endl;
 
+        test_two_element_operation(new_vector, [](const u256& lhs, const u256& rhs) { return lhs << static_cast<int>(rhs[0] % 256U); }, "shl", "New");
+        test_two_element_operation(new_vector, [](const u256& lhs, const u256& rhs) { return lhs >> static_cast<int>(rhs[0] % 256U); }, "shr", "New");
+
+        std::cout << std::endl;
+
+        // Low 256 bits of the full product, and a single word multiplier as in the rounding paths
+        test_two_element_operation(new_vector, std::multiplies<>(), "mul", "New");
+        test_two_element_operation(new_vector, [](const u256& lhs, const u256& rhs) { return lhs * rhs[0]; }, "mul", "New x 64");
+
+        std::cout << std::endl;
+
         test_two_element_operation(new_vector, std::divides<>(), "div", "New");
 
+        // A single word divisor as in the rounding paths
+        test_two_element_operation(new_vector, [](const u256& lhs, const u256& rhs) { return lhs / rhs[0]; }, "div", "New x 64");
+
+        // Powers of ten, with and without the precomputed reciprocals
+        test_two_element_operation(new_vector, [](const u256& lhs, const u256& rhs) { return lhs / pow10(u256{rhs[0] % 78U}); }, "div", "New x 10^k");
+        test_two_element_operation(new_vector, [](const u256& lhs, const u256& rhs) { return div_pow10(lhs, static_cast<int>(rhs[0] % 78U)); }, "div", "pow10");
+
         std::cout << std::endl;
 
         test_digit_counting(new_vector, "new");
@@ -276,7 +311,7 @@ int main()
 
         std::cout << std::endl;
 
-        test_umul256_new(new_vector, "new");
+        test_umul256(new_vector, "new");
     }
 
     // 4 x 2 word operations
@@ -296,10 +331,23 @@ int main()
         std::cout << std::endl;
 
         test_two_element_operation(new_vector, std::divides<>(), "div", "New");
+        test_two_element_operation(new_vector, std::modulus<>(), "mod", "New");
 
         std::cout << std::endl;
     }
 
+    // Digit counting over uniformly distributed digit lengths
+    {
+        std::cout << "\n---------------------------\n";
+        std::cout << "Digit Counting\n";
+        std::cout << "---------------------------\n\n";
+
+        test_digit_counting(generate_uniform_digits_vector<std::uint32_t>(std::numeric_limits<std::uint32_t>::digits10), "uint32_t");
+        test_digit_counting(generate_uniform_digits_vector<std::uint64_t>(std::numeric_limits<std::uint64_t>::digits10), "uint64_t");
+        test_digit_counting(generate_uniform_digits_vector<boost::int128::uint128_t>(std::numeric_limits<boost::int128::uint128_t>::digits10), "uint128_t");
+        test_digit_counting(generate_uniform_digits_vector<u256>(std::numeric_limits<u256>::digits10 - 1), "u256");
+    }
+
     return 1;
 }
 
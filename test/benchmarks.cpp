@@ -7,6 +7,7 @@
 #define BOOST_DECIMAL_DETAIL_INT128_ALLOW_SIGN_COMPARE
 
 #include <boost/decimal.hpp>
+#include <boost/decimal/parallel.hpp>
 #include <chrono>
 #include <random>
 #include <vector>
@@ -16,6 +17,10 @@
 #include <string>
 #include <cmath>
 #include <cstring>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <utility>
 
 #if defined(__clang__)
 #  pragma clang diagnostic push
@@ -132,6 +137,36 @@ std::vector<ResultType> convert_copy_vector(const std::vector<T>& v)
     return r;
 }
 
+// Amounts in cents of either sign, as in a ledger
+template <typename T>
+std::vector<T> generate_amount_vector(std::size_t size = N, unsigned seed = 42U)
+{
+    std::vector<T> v(size);
+
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::int64_t> sig_dis(-9'999'999, 9'999'999);
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = T{sig_dis(gen), -2};
+    }
+    return v;
+}
+
+// Fraction of neighbouring pairs that decimal32_t and decimal64_t add directly on their encodings
+template <typename T, typename BitsType, BitsType significand_mask>
+void report_same_quantum_hit_rate(const std::vector<T>& data_vec, const char* type)
+{
+    std::size_t hits {};
+    for (std::size_t i {}; i < data_vec.size() - 1U; ++i)
+    {
+        BitsType res {};
+        hits += static_cast<std::size_t>(detail::bid_same_quantum_add<BitsType, significand_mask>(to_bits(data_vec[i]), to_bits(data_vec[i + 1]), res));
+    }
+
+    std::cerr << "Encoded hit rate    <" << std::left << std::setw(13) << type << ">: " << 100.0 * static_cast<double>(hits) / static_cast<double>(data_vec.size() - 1U) << " %\n";
+}
+
 template <typename T>
 BOOST_DECIMAL_NO_INLINE void test_comparisons(const std::vector<T>& data_vec, const char* label)
 {
@@ -179,6 +214,530 @@ BOOST_DECIMAL_NO_INLINE void test_two_element_operation(const std::vector<T>& da
     std::cerr << operation << "<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
 }
 
+// Compares element-wise scalar operators against the batched kernels on the same data
+template <typename T, typename Func, typename BatchFunc>
+BOOST_DECIMAL_NO_INLINE void test_batch_operation(const std::vector<T>& data_vec, Func op, BatchFunc batch_op, const char* operation, const char* type)
+{
+    const auto n {data_vec.size() - 1U};
+    std::vector<T> out(n);
+
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < n; ++i)
+        {
+            out[i] = op(data_vec[i], data_vec[i + 1]);
+        }
+        s += static_cast<std::size_t>(signbit(out[k]));
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << " scalar<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+    s = 0;
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        batch_op(data_vec.data(), data_vec.data() + 1, out.data(), n);
+        s += static_cast<std::size_t>(signbit(out[k]));
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << operation << " batch <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_multiplier(const std::vector<T>& data_vec, const T rate, const char* type)
+{
+    std::vector<T> out(data_vec.size());
+
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < data_vec.size(); ++i)
+        {
+            out[i] = data_vec[i] * rate;
+        }
+        s += static_cast<std::size_t>(signbit(out[k]));
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Multiplication scalar    <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+    s = 0;
+
+    const decimal_multiplier<T> multiplier {rate};
+    for (std::size_t k {}; k < K; ++k)
+    {
+        multiplier.multiply(data_vec.data(), out.data(), data_vec.size());
+        s += static_cast<std::size_t>(signbit(out[k]));
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Multiplication multiplier<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_divider(const std::vector<T>& data_vec, const T divisor, const char* type)
+{
+    std::vector<T> out(data_vec.size());
+
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < data_vec.size(); ++i)
+        {
+            out[i] = data_vec[i] / divisor;
+        }
+        s += static_cast<std::size_t>(signbit(out[k]));
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Division scalar <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+    s = 0;
+
+    const decimal_divider<T> divider {divisor};
+    for (std::size_t k {}; k < K; ++k)
+    {
+        divider.divide(data_vec.data(), out.data(), data_vec.size());
+        s += static_cast<std::size_t>(signbit(out[k]));
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Division divider<" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_accumulator(const std::vector<T>& data_vec, const char* type)
+{
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        T sum {0};
+        for (std::size_t i {}; i < data_vec.size(); ++i)
+        {
+            sum += data_vec[i];
+        }
+        s += static_cast<std::size_t>(signbit(sum));
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Sum operator    <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+    s = 0;
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        decimal_accumulator<T> acc {};
+        acc.accumulate(data_vec.data(), data_vec.size());
+        s += static_cast<std::size_t>(signbit(acc.result()));
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Sum accumulator <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_dot(const std::vector<T>& a, const std::vector<T>& b, const char* type)
+{
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        T sum {0};
+        for (std::size_t i {}; i < a.size(); ++i)
+        {
+            sum = fma(a[i], b[i], sum);
+        }
+        s += static_cast<std::size_t>(signbit(sum));
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Dot fma   <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+    s = 0;
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        s += static_cast<std::size_t>(signbit(dot(a.data(), b.data(), a.size())));
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Dot exact <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_parallel_sum(const std::vector<T>& data_vec, const char* type)
+{
+    // 1, 2, 4, ... threads up to the number of hardware threads
+    const auto max_threads {std::thread::hardware_concurrency() > 1U ? std::thread::hardware_concurrency() : 1U};
+    std::vector<unsigned> thread_counts {};
+    for (unsigned threads {1U}; threads < max_threads; threads *= 2U)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (const auto threads : thread_counts)
+    {
+        const auto t1 = std::chrono::steady_clock::now();
+        std::size_t s = 0; // discard variable
+
+        for (std::size_t k {}; k < K; ++k)
+        {
+            s += static_cast<std::size_t>(signbit(parallel_sum(data_vec.data(), data_vec.size(), threads)));
+        }
+
+        const auto t2 = std::chrono::steady_clock::now();
+
+        std::cerr << "Threads " << std::setw(3) << threads << " <" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+    }
+}
+
+// Every thread multiplies the whole vector in its own rounding mode.
+// Without contention on the rounding mode the time stays flat up to the number of hardware threads.
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_thread_rounding_modes(const std::vector<T>& data_vec, const char* type)
+{
+    constexpr rounding_mode modes[] {rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_upward,
+                                     rounding_mode::fe_dec_downward, rounding_mode::fe_dec_toward_zero};
+
+    const auto max_threads {std::thread::hardware_concurrency() > 1U ? std::thread::hardware_concurrency() : 1U};
+    std::vector<unsigned> thread_counts {};
+    for (unsigned threads {1U}; threads < max_threads; threads *= 2U)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (const auto threads : thread_counts)
+    {
+        std::atomic<std::size_t> s {0}; // discard variable
+
+        const auto worker = [&](const rounding_mode round)
+        {
+            const rounding_scope scope {round};
+            std::size_t local_s {};
+
+            for (std::size_t k {}; k < K; ++k)
+            {
+                for (std::size_t i {}; i < data_vec.size() - 1U; ++i)
+                {
+                    local_s += static_cast<std::size_t>(data_vec[i] * data_vec[i + 1U] > data_vec[i]);
+                }
+            }
+
+            s += local_s;
+        };
+
+        const auto t1 = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers {};
+        for (unsigned i {}; i < threads; ++i)
+        {
+            workers.emplace_back(worker, modes[i % 4U]);
+        }
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+
+        const auto t2 = std::chrono::steady_clock::now();
+
+        std::cerr << "Threads " << std::setw(3) << threads << " <" << std::left << std::setw(11) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s.load() << ")\n";
+    }
+}
+
+// Rounds upward, once through the operators with the rounding mode of the thread
+// and once with the mode fixed at compile time
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_directed_rounding(const std::vector<T>& data_vec, const char* type)
+{
+    constexpr auto upward {rounding_mode::fe_dec_upward};
+
+    {
+        const rounding_scope scope {upward};
+        test_two_element_operation(data_vec, std::plus<>(), "Addition scope      ", type);
+    }
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return add<upward>(lhs, rhs); }, "Addition fixed      ", type);
+
+    {
+        const rounding_scope scope {upward};
+        test_two_element_operation(data_vec, std::multiplies<>(), "Multiplication scope", type);
+    }
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return mul<upward>(lhs, rhs); }, "Multiplication fixed", type);
+
+    {
+        const rounding_scope scope {upward};
+        test_two_element_operation(data_vec, std::divides<>(), "Division scope      ", type);
+    }
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return div<upward>(lhs, rhs); }, "Division fixed      ", type);
+}
+
+// Compare the times with and without BOOST_DECIMAL_ENABLE_STATUS_FLAGS defined to see the cost of raising the flags
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_status_flags(const std::vector<T>& data_vec, const char* type)
+{
+    feclearexcept(status_flags::fe_dec_all_except);
+
+    test_two_element_operation(data_vec, std::plus<>(), "Addition      ", type);
+    test_two_element_operation(data_vec, std::multiplies<>(), "Multiplication", type);
+    test_two_element_operation(data_vec, std::divides<>(), "Division      ", type);
+
+    std::cerr << "Raised flags  <" << std::left << std::setw(11) << type << ">: "
+              << static_cast<unsigned>(fetestexcept(status_flags::fe_dec_all_except)) << '\n';
+}
+
+// The operators against the functions which skip the checks for non-finite values
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_unchecked(const std::vector<T>& data_vec, const char* type)
+{
+    test_two_element_operation(data_vec, std::plus<>(), "Addition            ", type);
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return unchecked_add(lhs, rhs); }, "Addition unchecked  ", type);
+
+    test_two_element_operation(data_vec, std::multiplies<>(), "Multiplication      ", type);
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return unchecked_mul(lhs, rhs); }, "Multiplication unch.", type);
+
+    test_two_element_operation(data_vec, std::divides<>(), "Division            ", type);
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return unchecked_div(lhs, rhs); }, "Division unchecked  ", type);
+
+    test_two_element_operation(data_vec, std::less<>(), "Less                ", type);
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return unchecked_less(lhs, rhs); }, "Less unchecked      ", type);
+}
+
+// A pass over a large array is bound by memory bandwidth rather than by decoding,
+// so the size of the type matters as much as its layout
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_layout(const std::vector<T>& data_vec, const char* type)
+{
+    std::cerr << "Size        <" << std::left << std::setw(13) << type << ">: " << sizeof(T) << " bytes\n";
+
+    const T threshold {12345, -2};
+
+    const auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < data_vec.size(); ++i)
+        {
+            s += static_cast<std::size_t>(data_vec[i] > threshold);
+        }
+    }
+
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Scan vector <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    test_two_element_operation(data_vec, std::plus<>(), "Addition            ", type);
+    test_two_element_operation(data_vec, std::multiplies<>(), "Multiplication      ", type);
+}
+
+// Compares fixed_decimal<2> with decimal64_t on the same amounts, which are exact in both
+BOOST_DECIMAL_NO_INLINE void test_fixed_decimal(std::vector<decimal64_t> dec_vec)
+{
+    using money = fixed_decimal<2>;
+
+    // The divisors must not be zero
+    std::vector<money> fixed_vec(dec_vec.size());
+    for (std::size_t i {}; i < dec_vec.size(); ++i)
+    {
+        if (dec_vec[i] == 0)
+        {
+            dec_vec[i] = decimal64_t{1, -2};
+        }
+        fixed_vec[i] = money{dec_vec[i]};
+    }
+
+    test_two_element_operation(dec_vec, std::plus<>(), "Addition            ", "decimal64_t");
+    test_two_element_operation(fixed_vec, [](const money lhs, const money rhs) { return (lhs + rhs).raw(); }, "Addition            ", "fixed_decimal");
+
+    test_two_element_operation(dec_vec, std::multiplies<>(), "Multiplication      ", "decimal64_t");
+    test_two_element_operation(fixed_vec, [](const money lhs, const money rhs) { return (lhs * rhs).raw(); }, "Multiplication      ", "fixed_decimal");
+
+    test_two_element_operation(dec_vec, std::divides<>(), "Division            ", "decimal64_t");
+    test_two_element_operation(fixed_vec, [](const money lhs, const money rhs) { return (lhs / rhs).raw(); }, "Division            ", "fixed_decimal");
+
+    test_two_element_operation(dec_vec, std::less<>(), "Less                ", "decimal64_t");
+    test_two_element_operation(fixed_vec, std::less<>(), "Less                ", "fixed_decimal");
+}
+
+// Quantities stored as decimal32_t against prices stored as decimal64_t
+BOOST_DECIMAL_NO_INLINE void test_mixed_width(const std::vector<decimal32_t>& qty_vec, const std::vector<decimal64_t>& price_vec)
+{
+    using entry = std::pair<decimal32_t, decimal64_t>;
+
+    std::vector<entry> data_vec(qty_vec.size());
+    for (std::size_t i {}; i < data_vec.size(); ++i)
+    {
+        data_vec[i] = entry{qty_vec[i], price_vec[i]};
+    }
+
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return lhs.first * rhs.second; }, "Multiplication      ", "mixed");
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return static_cast<decimal64_t>(lhs.first) * rhs.second; }, "Multiplication      ", "promoted");
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return lhs.first + rhs.second; }, "Addition            ", "mixed");
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return static_cast<decimal64_t>(lhs.first) + rhs.second; }, "Addition            ", "promoted");
+}
+
+// The integer operand is used directly as a significand instead of being converted to a decimal first
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_integer_operand(const std::vector<T>& dec_vec, const char* type)
+{
+    using entry = std::pair<T, int>;
+
+    std::vector<entry> data_vec(dec_vec.size());
+    for (std::size_t i {}; i < data_vec.size(); ++i)
+    {
+        data_vec[i] = entry{dec_vec[i], static_cast<int>(i % 997U) + 1};
+    }
+
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return lhs.first * rhs.second; }, "Multiplication      ", type);
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return lhs.first / rhs.second; }, "Division            ", type);
+    test_two_element_operation(data_vec, [](const entry& lhs, const entry& rhs) { return lhs.first + rhs.second; }, "Addition            ", type);
+}
+
+// The operators round after every operation, and the expression rounds once at the end
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_lazy_expression(const std::vector<T>& data_vec, const char* type)
+{
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return lhs * rhs + lhs - rhs; }, "a * b + a - b       ", type);
+    test_two_element_operation(data_vec, [](const T lhs, const T rhs) { return static_cast<T>(lazy(lhs) * rhs + lhs - rhs); }, "a * b + a - b lazy  ", type);
+}
+
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_column_scan(const std::vector<T>& data_vec, const T threshold, const char* type)
+{
+    std::unique_ptr<bool[]> mask {new bool[data_vec.size()]};
+
+    auto t1 = std::chrono::steady_clock::now();
+    std::size_t s = 0; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < data_vec.size(); ++i)
+        {
+            mask[i] = data_vec[i] > threshold;
+        }
+        s += static_cast<std::size_t>(mask[k]);
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Scan vector <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    const decimal_column<T> column {data_vec.data(), data_vec.size()};
+
+    t1 = std::chrono::steady_clock::now();
+    s = 0;
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        column.greater(threshold, mask.get());
+        s += static_cast<std::size_t>(mask[k]);
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Scan column <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
+// The element-wise arithmetic and the sum of a column take the same scalar paths as a loop over a vector,
+// so this measures what the lanes cost or save for them
+template <typename T>
+BOOST_DECIMAL_NO_INLINE void test_column_arithmetic(const std::vector<T>& data_vec, const char* type)
+{
+    const std::vector<T> rhs_vec(data_vec.rbegin(), data_vec.rend());
+    auto res_vec {data_vec};
+
+    auto t1 = std::chrono::steady_clock::now();
+    T s {0}; // discard variable
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        for (std::size_t i {}; i < res_vec.size(); ++i)
+        {
+            res_vec[i] += rhs_vec[i];
+        }
+        s += res_vec[k];
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "+=  vector  <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    const decimal_column<T> rhs_column {rhs_vec.data(), rhs_vec.size()};
+    decimal_column<T> res_column {data_vec.data(), data_vec.size()};
+
+    t1 = std::chrono::steady_clock::now();
+    s = T{0};
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        res_column += rhs_column;
+        s += res_column[k];
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "+=  column  <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+    s = T{0};
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        T total {0};
+        for (const auto val : data_vec)
+        {
+            total += val;
+        }
+        s += total;
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Sum vector  <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+
+    const decimal_column<T> column {data_vec.data(), data_vec.size()};
+
+    t1 = std::chrono::steady_clock::now();
+    s = T{0};
+
+    for (std::size_t k {}; k < K; ++k)
+    {
+        s += column.sum();
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cerr << "Sum column  <" << std::left << std::setw(13) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << s << ")\n";
+}
+
 template <typename T, typename Func>
 BOOST_DECIMAL_NO_INLINE void test_one_element_operation(const std::vector<T>& data_vec, Func op, const char* operation, const char* type, std::size_t max_element = N)
 {
@@ -435,6 +994,19 @@ int main()
     test_two_element_operation(dec64_fast_vector, std::plus<>(), "Addition", "dec64_fast");
     test_two_element_operation(dec128_fast_vector, std::plus<>(), "Addition", "dec128_fast");
 
+    // Currency amounts, most of which share an exponent once expanded to full precision
+    std::cerr << "\n===== Addition (Same Quantum) =====\n";
+
+    test_two_element_operation(generate_amount_vector<decimal32_t>(), std::plus<>(), "Addition", "decimal32_t");
+    test_two_element_operation(generate_amount_vector<decimal64_t>(), std::plus<>(), "Addition", "decimal64_t");
+    test_two_element_operation(generate_amount_vector<decimal128_t>(), std::plus<>(), "Addition", "decimal128_t");
+    test_two_element_operation(generate_amount_vector<decimal_fast32_t>(), std::plus<>(), "Addition", "dec32_fast");
+    test_two_element_operation(generate_amount_vector<decimal_fast64_t>(), std::plus<>(), "Addition", "dec64_fast");
+    test_two_element_operation(generate_amount_vector<decimal_fast128_t>(), std::plus<>(), "Addition", "dec128_fast");
+
+    report_same_quantum_hit_rate<decimal32_t, std::uint32_t, detail::d32_not_11_significand_mask>(generate_amount_vector<decimal32_t>(), "decimal32_t");
+    report_same_quantum_hit_rate<decimal64_t, std::uint64_t, detail::d64_not_11_significand_mask>(generate_amount_vector<decimal64_t>(), "decimal64_t");
+
     std::cerr << "\n===== Subtraction =====\n";
 
     test_two_element_operation(float_vector, std::minus<>(), "Subtraction", "float");
@@ -457,6 +1029,11 @@ int main()
     test_two_element_operation(dec64_fast_vector, std::multiplies<>(), "Multiplication", "dec64_fast");
     test_two_element_operation(dec128_fast_vector, std::multiplies<>(), "Multiplication", "dec128_fast");
 
+    std::cerr << "\n===== Multiplication (Short Significands) =====\n";
+
+    test_two_element_operation(generate_amount_vector<decimal128_t>(), std::multiplies<>(), "Multiplication", "decimal128_t");
+    test_two_element_operation(generate_amount_vector<decimal_fast128_t>(), std::multiplies<>(), "Multiplication", "dec128_fast");
+
     std::cerr << "\n===== Division =====\n";
 
     test_two_element_operation(float_vector, std::divides<>(), "Division", "float");
@@ -468,6 +1045,135 @@ int main()
     test_two_element_operation(dec64_fast_vector, std::divides<>(), "Division", "dec64_fast");
     test_two_element_operation(dec128_fast_vector, std::divides<>(), "Division", "dec128_fast");
 
+    std::cerr << "\n===== Batched Addition and Subtraction =====\n";
+
+    test_batch_operation(dec64_vector, std::plus<>(), add<decimal64_t>, "Addition", "decimal64_t");
+    test_batch_operation(dec64_fast_vector, std::plus<>(), add<decimal_fast64_t>, "Addition", "dec64_fast");
+    test_batch_operation(dec64_vector, std::minus<>(), sub<decimal64_t>, "Subtraction", "decimal64_t");
+    test_batch_operation(dec64_fast_vector, std::minus<>(), sub<decimal_fast64_t>, "Subtraction", "dec64_fast");
+
+    std::cerr << "\n===== Multiplication by a Fixed Rate =====\n";
+
+    test_multiplier(dec32_vector, decimal32_t{10825, -4}, "decimal32_t");
+    test_multiplier(dec64_vector, decimal64_t{10825, -4}, "decimal64_t");
+    test_multiplier(dec128_vector, decimal128_t{10825, -4}, "decimal128_t");
+    test_multiplier(dec32_fast_vector, decimal_fast32_t{10825, -4}, "dec32_fast");
+    test_multiplier(dec64_fast_vector, decimal_fast64_t{125, -2}, "dec64_fast");
+    test_multiplier(dec128_fast_vector, decimal_fast128_t{10825, -4}, "dec128_fast");
+
+    std::cerr << "\n===== Division by a Fixed Divisor =====\n";
+
+    test_divider(dec32_vector, decimal32_t{1000}, "decimal32_t");
+    test_divider(dec64_vector, decimal64_t{1000}, "decimal64_t");
+    test_divider(dec128_vector, decimal128_t{1000}, "decimal128_t");
+    test_divider(dec32_fast_vector, decimal_fast32_t{1000}, "dec32_fast");
+    test_divider(dec64_fast_vector, decimal_fast64_t{1000}, "dec64_fast");
+    test_divider(dec128_fast_vector, decimal_fast128_t{1000}, "dec128_fast");
+
+    std::cerr << "\n===== Column Scan =====\n";
+
+    test_column_scan(dec32_fast_vector, decimal_fast32_t{12345, -2}, "dec32_fast");
+    test_column_scan(dec64_fast_vector, decimal_fast64_t{12345, -2}, "dec64_fast");
+    test_column_scan(dec128_fast_vector, decimal_fast128_t{12345, -2}, "dec128_fast");
+
+    std::cerr << "\n===== Column Arithmetic =====\n";
+
+    test_column_arithmetic(generate_amount_vector<decimal_fast64_t>(), "dec64_fast");
+
+    std::cerr << "\n===== Summation =====\n";
+
+    test_accumulator(generate_amount_vector<decimal32_t>(), "decimal32_t");
+    test_accumulator(generate_amount_vector<decimal64_t>(), "decimal64_t");
+    test_accumulator(generate_amount_vector<decimal128_t>(), "decimal128_t");
+    test_accumulator(generate_amount_vector<decimal_fast32_t>(), "dec32_fast");
+    test_accumulator(generate_amount_vector<decimal_fast64_t>(), "dec64_fast");
+    test_accumulator(generate_amount_vector<decimal_fast128_t>(), "dec128_fast");
+
+    std::cerr << "\n===== Dot Product =====\n";
+
+    test_dot(generate_amount_vector<decimal32_t>(), generate_amount_vector<decimal32_t>(N, 7U), "decimal32_t");
+    test_dot(generate_amount_vector<decimal64_t>(), generate_amount_vector<decimal64_t>(N, 7U), "decimal64_t");
+    test_dot(generate_amount_vector<decimal128_t>(), generate_amount_vector<decimal128_t>(N, 7U), "decimal128_t");
+    test_dot(generate_amount_vector<decimal_fast32_t>(), generate_amount_vector<decimal_fast32_t>(N, 7U), "dec32_fast");
+    test_dot(generate_amount_vector<decimal_fast64_t>(), generate_amount_vector<decimal_fast64_t>(N, 7U), "dec64_fast");
+    test_dot(generate_amount_vector<decimal_fast128_t>(), generate_amount_vector<decimal_fast128_t>(N, 7U), "dec128_fast");
+
+    std::cerr << "\n===== Parallel Summation =====\n";
+
+    test_parallel_sum(generate_amount_vector<decimal64_t>(), "decimal64_t");
+    test_parallel_sum(generate_amount_vector<decimal128_t>(), "decimal128_t");
+    test_parallel_sum(generate_amount_vector<decimal_fast64_t>(), "dec64_fast");
+    test_parallel_sum(generate_amount_vector<decimal_fast128_t>(), "dec128_fast");
+
+    std::cerr << "\n===== Per Thread Rounding Modes =====\n";
+
+    test_thread_rounding_modes(generate_amount_vector<decimal64_t>(), "decimal64_t");
+    test_thread_rounding_modes(generate_amount_vector<decimal128_t>(), "decimal128_t");
+
+    std::cerr << "\n===== Directed Rounding =====\n";
+
+    test_directed_rounding(dec32_vector, "decimal32_t");
+    test_directed_rounding(dec64_vector, "decimal64_t");
+    test_directed_rounding(dec128_vector, "decimal128_t");
+    test_directed_rounding(dec32_fast_vector, "dec32_fast");
+    test_directed_rounding(dec64_fast_vector, "dec64_fast");
+    test_directed_rounding(dec128_fast_vector, "dec128_fast");
+
+    #ifdef BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+    std::cerr << "\n===== Status Flags (Enabled) =====\n";
+    #else
+    std::cerr << "\n===== Status Flags (Disabled) =====\n";
+    #endif
+
+    test_status_flags(dec32_vector, "decimal32_t");
+    test_status_flags(dec64_vector, "decimal64_t");
+    test_status_flags(dec128_vector, "decimal128_t");
+    test_status_flags(dec32_fast_vector, "dec32_fast");
+    test_status_flags(dec64_fast_vector, "dec64_fast");
+    test_status_flags(dec128_fast_vector, "dec128_fast");
+
+    std::cerr << "\n===== Unchecked =====\n";
+
+    test_unchecked(dec32_vector, "decimal32_t");
+    test_unchecked(dec64_vector, "decimal64_t");
+    test_unchecked(dec128_vector, "decimal128_t");
+    test_unchecked(dec32_fast_vector, "dec32_fast");
+    test_unchecked(dec64_fast_vector, "dec64_fast");
+    test_unchecked(dec128_fast_vector, "dec128_fast");
+
+    #ifdef BOOST_DECIMAL_COMPACT_FAST128
+    std::cerr << "\n===== 128-bit Layouts (Compact) =====\n";
+    #else
+    std::cerr << "\n===== 128-bit Layouts =====\n";
+    #endif
+
+    test_layout(dec128_vector, "decimal128_t");
+    test_layout(dec128_fast_vector, "dec128_fast");
+
+    std::cerr << "\n===== Fixed Point =====\n";
+
+    test_fixed_decimal(generate_amount_vector<decimal64_t>());
+
+    std::cerr << "\n===== Expression Templates =====\n";
+
+    test_lazy_expression(dec32_vector, "decimal32_t");
+    test_lazy_expression(dec64_vector, "decimal64_t");
+    test_lazy_expression(dec128_vector, "decimal128_t");
+    test_lazy_expression(dec64_fast_vector, "dec64_fast");
+
+    std::cerr << "\n===== Mixed Width =====\n";
+
+    test_mixed_width(dec32_vector, dec64_vector);
+
+    std::cerr << "\n===== Integer Operand =====\n";
+
+    test_integer_operand(dec32_vector, "decimal32_t");
+    test_integer_operand(dec64_vector, "decimal64_t");
+    test_integer_operand(dec128_vector, "decimal128_t");
+    test_integer_operand(dec32_fast_vector, "dec32_fast");
+    test_integer_operand(dec64_fast_vector, "dec64_fast");
+    test_integer_operand(dec128_fast_vector, "dec128_fast");
+
 #if 0
     std::cerr << "\n===== sqrt =====\n";
 
@@ -188,8 +188,54 @@ void random_mixed_division(T lower, T upper)
     BOOST_TEST(isinf(Decimal2(dist(rng)) / Decimal1(0)));
 }
 
+// The mixed operators decode the narrower operand straight into the wider type,
+// which must give the same results as converting it first
+template <typename Decimal1, typename Decimal2>
+void random_mixed_promotion()
+{
+    using promoted_type = decltype(Decimal1{} + Decimal2{});
+
+    std::uniform_int_distribution<std::uint32_t> sig_dist(0U, 9'999'999U);
+    std::uniform_int_distribution<int> exp_dist(-20, 20);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const Decimal1 dec1 {sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1};
+        const Decimal2 dec2 {sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1};
+
+        const auto wide1 {static_cast<promoted_type>(dec1)};
+        const auto wide2 {static_cast<promoted_type>(dec2)};
+
+        BOOST_TEST_EQ(dec1 + dec2, wide1 + wide2);
+        BOOST_TEST_EQ(dec1 - dec2, wide1 - wide2);
+        BOOST_TEST_EQ(dec1 * dec2, wide1 * wide2);
+    }
+
+    const Decimal1 zero1 {0};
+    const Decimal2 zero2 {0};
+    const auto wide_zero1 {static_cast<promoted_type>(zero1)};
+    const auto wide_zero2 {static_cast<promoted_type>(zero2)};
+
+    BOOST_TEST_EQ(signbit(-zero1 + zero2), signbit(-wide_zero1 + wide_zero2));
+    BOOST_TEST_EQ(signbit(-zero1 - zero2), signbit(-wide_zero1 - wide_zero2));
+    BOOST_TEST_EQ(signbit(-zero1 * zero2), signbit(-wide_zero1 * wide_zero2));
+    BOOST_TEST(isnan(std::numeric_limits<Decimal1>::infinity() * zero2));
+}
+
 int main()
 {
+    random_mixed_promotion<decimal32_t, decimal64_t>();
+    random_mixed_promotion<decimal64_t, decimal32_t>();
+    random_mixed_promotion<decimal32_t, decimal128_t>();
+    random_mixed_promotion<decimal128_t, decimal64_t>();
+    random_mixed_promotion<decimal64_t, decimal_fast64_t>();
+    random_mixed_promotion<decimal_fast32_t, decimal64_t>();
+    random_mixed_promotion<decimal32_t, decimal_fast32_t>();
+    random_mixed_promotion<decimal_fast64_t, decimal128_t>();
+    random_mixed_promotion<decimal32_t, decimal_fast128_t>();
+    random_mixed_promotion<decimal_fast128_t, decimal64_t>();
+
     random_mixed_addition<decimal32_t, decimal64_t>(0, 5'000'000);
     random_mixed_addition<decimal32_t, decimal64_t>(0LL, 5'000'000LL);
     random_mixed_addition<decimal64_t, decimal32_t>(0, 5'000'000);
@@ -0,0 +1,35 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The status flags raised in one translation unit are seen in every other, also before C++17
+
+#define BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+using namespace boost::decimal;
+
+void raise_overflow();
+auto divide(decimal64_t lhs, decimal64_t rhs) -> decimal64_t;
+auto test_inexact() -> status_flags;
+
+int main()
+{
+    feclearexcept(status_flags::fe_dec_all_except);
+
+    raise_overflow();
+    BOOST_TEST(fetestexcept(status_flags::fe_dec_overflow) == status_flags::fe_dec_overflow);
+
+    static_cast<void>(divide(decimal64_t{1}, decimal64_t{3}));
+    BOOST_TEST(fetestexcept(status_flags::fe_dec_inexact) == status_flags::fe_dec_inexact);
+
+    feclearexcept(status_flags::fe_dec_all_except);
+    BOOST_TEST(test_inexact() == status_flags{});
+
+    feraiseexcept(status_flags::fe_dec_inexact);
+    BOOST_TEST(test_inexact() == status_flags::fe_dec_inexact);
+
+    return boost::report_errors();
+}
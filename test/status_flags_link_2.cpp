@@ -0,0 +1,24 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+
+#include <boost/decimal.hpp>
+
+using namespace boost::decimal;
+
+void raise_overflow()
+{
+    feraiseexcept(status_flags::fe_dec_overflow);
+}
+
+auto divide(const decimal64_t lhs, const decimal64_t rhs) -> decimal64_t
+{
+    return lhs / rhs;
+}
+
+auto test_inexact() -> status_flags
+{
+    return fetestexcept(status_flags::fe_dec_inexact);
+}
@@ -0,0 +1,129 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+// The exactly rounded sum, computed without going through operator+
+template <typename DecimalType>
+DecimalType reference_sum(const DecimalType lhs, const DecimalType rhs)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc += lhs;
+    acc += rhs;
+    return acc.result();
+}
+
+// Significands with the same number of digits share an exponent once expanded to full precision
+template <typename DecimalType>
+std::int64_t min_significand()
+{
+    std::int64_t min_sig {1};
+    for (int i {}; i < (std::min)(std::numeric_limits<DecimalType>::digits10, 18) - 1; ++i)
+    {
+        min_sig *= 10;
+    }
+
+    return min_sig;
+}
+
+template <typename DecimalType>
+void test_random()
+{
+    const auto min_sig {min_significand<DecimalType>()};
+    std::uniform_int_distribution<std::int64_t> sig_dist {min_sig, min_sig * 10 - 1};
+    std::uniform_int_distribution<int> exp_dist {-20, 20};
+    std::uniform_int_distribution<int> sign_dist {0, 1};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto exp {exp_dist(rng)};
+        const DecimalType lhs {sign_dist(rng) == 1 ? -sig_dist(rng) : sig_dist(rng), exp};
+        const DecimalType rhs {sign_dist(rng) == 1 ? -sig_dist(rng) : sig_dist(rng), exp};
+
+        check_same(lhs + rhs, reference_sum(lhs, rhs));
+        check_same(lhs - rhs, reference_sum(lhs, -rhs));
+    }
+}
+
+template <typename DecimalType>
+void test_carries()
+{
+    const auto min_sig {min_significand<DecimalType>()};
+    const DecimalType max_sig {min_sig * 10 - 1, 3};
+    const DecimalType half {min_sig * 5, 3};
+
+    // The carry into an extra digit is rounded when it does not fit in the precision
+    check_same(max_sig + half, reference_sum(max_sig, half));
+    check_same(-max_sig - half, reference_sum(-max_sig, -half));
+    check_same(max_sig + max_sig, reference_sum(max_sig, max_sig));
+    check_same(half - max_sig, reference_sum(half, -max_sig));
+
+    // Overflow at the largest exponent
+    const auto max {std::numeric_limits<DecimalType>::max()};
+    check_same(max + max, std::numeric_limits<DecimalType>::infinity());
+    check_same(-max - max, -std::numeric_limits<DecimalType>::infinity());
+}
+
+template <typename DecimalType>
+void test_zeros()
+{
+    const DecimalType val {min_significand<DecimalType>() * 3, -2};
+
+    // Cancellation gives +0, and the sum of two -0s is -0
+    check_same(val - val, DecimalType{0});
+    check_same(-val + val, DecimalType{0});
+    check_same(DecimalType{0} + -DecimalType{0}, DecimalType{0});
+    check_same(-DecimalType{0} + -DecimalType{0}, -DecimalType{0});
+    check_same(-DecimalType{0} - DecimalType{0}, -DecimalType{0});
+    check_same(val + DecimalType{0}, val);
+    check_same(-DecimalType{0} - val, -val);
+}
+
+template <typename DecimalType>
+void test_rounding_modes()
+{
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    const auto mode {boost::decimal::fegetround()};
+
+    for (const auto round : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                             rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward})
+    {
+        boost::decimal::fesetround(round);
+        test_random<DecimalType>();
+        test_carries<DecimalType>();
+    }
+
+    boost::decimal::fesetround(mode);
+    #endif
+}
+
+template <typename DecimalType>
+void test()
+{
+    test_random<DecimalType>();
+    test_carries<DecimalType>();
+    test_zeros<DecimalType>();
+    test_rounding_modes<DecimalType>();
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,148 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+template <typename DecimalType>
+void test_against_scalar(const std::vector<DecimalType>& a, const std::vector<DecimalType>& b)
+{
+    std::vector<DecimalType> sum(a.size());
+    std::vector<DecimalType> difference(a.size());
+
+    add(a.data(), b.data(), sum.data(), a.size());
+    sub(a.data(), b.data(), difference.data(), a.size());
+
+    for (std::size_t i {}; i < a.size(); ++i)
+    {
+        check_same_encoding(sum[i], a[i] + b[i]);
+        check_same_encoding(difference[i], a[i] - b[i]);
+    }
+}
+
+template <typename DecimalType>
+void test_random()
+{
+    // Wide exponent range exercises alignment and the far-shift rounding paths
+    test_against_scalar(generate_values<DecimalType>(N, -50, 50), generate_values<DecimalType>(N, -50, 50));
+
+    // Close exponents are the common case for currency values
+    test_against_scalar(generate_values<DecimalType>(N, -4, -2), generate_values<DecimalType>(N, -4, -2));
+
+    // Same quantum with and without a carry out of the precision
+    test_against_scalar(generate_values<DecimalType>(N, -2, -2, 100'000), generate_values<DecimalType>(N, -2, -2, 100'000));
+    test_against_scalar(generate_values<DecimalType>(N, 5, 5), generate_values<DecimalType>(N, 5, 5));
+    test_against_scalar(generate_values<DecimalType>(N, -398, -396, 1'000), generate_values<DecimalType>(N, -398, -396, 1'000));
+
+    // Lengths that are not a multiple of the block size
+    for (std::size_t size {}; size < 200U; size += 7U)
+    {
+        test_against_scalar(generate_values<DecimalType>(size, -10, 10), generate_values<DecimalType>(size, -10, 10));
+    }
+}
+
+template <typename DecimalType>
+void test_special_values()
+{
+    auto a {generate_values<DecimalType>(N, -20, 20)};
+    auto b {generate_values<DecimalType>(N, -20, 20)};
+
+    a[3] = std::numeric_limits<DecimalType>::infinity();
+    b[3] = -std::numeric_limits<DecimalType>::infinity();
+    a[70] = std::numeric_limits<DecimalType>::quiet_NaN();
+    b[200] = std::numeric_limits<DecimalType>::infinity();
+    a[500] = DecimalType{0U, 5};
+    b[500] = DecimalType{0U, -3, true};
+    a[501] = DecimalType{0U, -7, true};
+    b[502] = DecimalType{0U, 12};
+    a[N - 1] = std::numeric_limits<DecimalType>::max();
+    b[N - 1] = std::numeric_limits<DecimalType>::max();
+
+    test_against_scalar(a, b);
+}
+
+template <typename DecimalType>
+void test_in_place()
+{
+    auto a {generate_values<DecimalType>(N, -8, 8)};
+    const auto b {generate_values<DecimalType>(N, -8, 8)};
+    const auto original {a};
+
+    add(a.data(), b.data(), a.data(), a.size());
+    for (std::size_t i {}; i < a.size(); ++i)
+    {
+        check_same_encoding(a[i], original[i] + b[i]);
+    }
+
+    sub(a.data(), b.data(), a.data(), a.size());
+    for (std::size_t i {}; i < a.size(); ++i)
+    {
+        check_same_encoding(a[i], (original[i] + b[i]) - b[i]);
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+void test_span()
+{
+    const auto a {generate_values<DecimalType>(N, -8, 8)};
+    const auto b {generate_values<DecimalType>(N, -8, 8)};
+    std::vector<DecimalType> sum(N);
+    std::vector<DecimalType> difference(N);
+
+    add(std::span<const DecimalType>{a}, std::span<const DecimalType>{b}, std::span<DecimalType>{sum});
+    sub(std::span<const DecimalType>{a}, std::span<const DecimalType>{b}, std::span<DecimalType>{difference});
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        check_same_encoding(sum[i], a[i] + b[i]);
+        check_same_encoding(difference[i], a[i] - b[i]);
+    }
+
+    // DecimalType is deduced from the output span, and the inputs convert from vectors and mutable spans
+    auto c {a};
+    add(a, std::span<DecimalType>{c}, std::span{sum});
+    sub(std::span<DecimalType>{c}, b, std::span{difference});
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        check_same_encoding(sum[i], a[i] + c[i]);
+        check_same_encoding(difference[i], c[i] - b[i]);
+    }
+}
+
+#endif
+
+template <typename DecimalType>
+void test()
+{
+    test_random<DecimalType>();
+    test_special_values<DecimalType>();
+    test_in_place<DecimalType>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span<DecimalType>();
+    #endif
+}
+
+int main()
+{
+    test<decimal64_t>();
+    test<decimal_fast64_t>();
+
+    // Types without a dedicated kernel forward to the scalar operators
+    test<decimal128_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
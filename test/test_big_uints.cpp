@@ -484,10 +484,299 @@ void test_digit_counting()
         current_power = current_power * UINT64_C(10);
         ++current_digits;
     }
+
+    BOOST_TEST_EQ(num_digits(T{0}), 1);
+    BOOST_TEST_EQ(num_digits((std::numeric_limits<T>::max)()), max_power + 1);
+}
+
+// The digit count is estimated from the bit width, so both ends of every
+// bit width and random values in between are checked against the control
+template<typename BoostCtrlUint_Type, typename DecInternUint_Type>
+auto test_digit_counting_bit_widths() -> void
+{
+  using boost_ctrl_uint_type = BoostCtrlUint_Type;
+  using dec_intern_uint_type = DecInternUint_Type;
+
+  using boost::decimal::detail::num_digits;
+
+  const auto ctrl_digits =
+    [](const boost_ctrl_uint_type& val)
+    {
+      std::stringstream strm { };
+      strm << val;
+      return static_cast<int>(strm.str().size());
+    };
+
+  std::mt19937_64 rng(local::time_point<std::mt19937_64::result_type>());
+
+  constexpr auto digits2 = std::numeric_limits<boost_ctrl_uint_type>::digits;
+
+  for(auto bits = static_cast<int>(INT8_C(1)); bits <= digits2; ++bits)
+  {
+    const boost_ctrl_uint_type ctrl_top { boost_ctrl_uint_type(1) << (bits - 1) };
+    const dec_intern_uint_type dec_top { dec_intern_uint_type(1) << (bits - 1) };
+
+    BOOST_TEST_EQ(num_digits(dec_top), ctrl_digits(ctrl_top));
+    BOOST_TEST_EQ(num_digits(dec_intern_uint_type(dec_top | (dec_top - 1U))), ctrl_digits(boost_ctrl_uint_type(ctrl_top | (ctrl_top - 1U))));
+
+    for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT8_C(16)); ++trials)
+    {
+      boost_ctrl_uint_type ctrl_val { 1 };
+      dec_intern_uint_type dec_val { 1 };
+
+      for(auto i = static_cast<int>(INT8_C(1)); i < bits; ++i)
+      {
+        const auto next_bit = static_cast<unsigned>(rng() & 1U);
+
+        ctrl_val <<= 1; ctrl_val |= boost_ctrl_uint_type(next_bit);
+        dec_val  <<= 1; dec_val  |= dec_intern_uint_type(next_bit);
+      }
+
+      BOOST_TEST_EQ(num_digits(dec_val), ctrl_digits(ctrl_val));
+    }
+  }
+}
+
+// Division by a single word returns the remainder in the low word,
+// so the remaining words of the result must all be cleared
+auto test_div_mod_single_word_divisor() -> void
+{
+  using boost_ctrl_uint_type = boost::multiprecision::uint256_t;
+  using dec_intern_uint_type = boost::decimal::detail::u256;
+
+  std::mt19937_64 rng(local::time_point<std::mt19937_64::result_type>());
+
+  for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT16_C(0x100)); ++trials)
+  {
+    const dec_intern_uint_type dec_intern_lhs { { rng(), rng() }, { rng(), rng() } };
+
+    boost_ctrl_uint_type boost_ctrl_lhs { 0 };
+    for(auto index = static_cast<int>(INT8_C(3)); index >= 0; --index)
+    {
+      boost_ctrl_lhs <<= 64;
+      boost_ctrl_lhs |= dec_intern_lhs[static_cast<std::size_t>(index)];
+    }
+
+    const auto rhs = static_cast<std::uint32_t>(rng() | 1U);
+
+    const auto dec_intern_res = boost::decimal::detail::impl::div_mod(dec_intern_lhs, dec_intern_uint_type { static_cast<std::uint64_t>(rhs) });
+
+    BOOST_TEST(local::declexical_cast(dec_intern_res.quotient) == local::declexical_cast(boost_ctrl_uint_type(boost_ctrl_lhs / rhs)));
+    BOOST_TEST(local::declexical_cast(dec_intern_res.remainder) == local::declexical_cast(boost_ctrl_uint_type(boost_ctrl_lhs % rhs)));
+  }
+}
+
+// Full range words, so that every carry of the multiplication and addition kernels is exercised
+auto test_full_range_mul_add() -> void
+{
+  using boost_ctrl_uint_type = boost::multiprecision::uint256_t;
+  using dec_intern_uint_type = boost::decimal::detail::u256;
+
+  std::mt19937_64 rng(local::time_point<std::mt19937_64::result_type>());
+
+  const auto to_ctrl = [](const dec_intern_uint_type& x)
+  {
+    boost_ctrl_uint_type result { 0 };
+    for(auto index = static_cast<int>(INT8_C(3)); index >= 0; --index)
+    {
+      result <<= 64;
+      result |= x[static_cast<std::size_t>(index)];
+    }
+    return result;
+  };
+
+  for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT16_C(0x400)); ++trials)
+  {
+    // Mostly words with all bits set, where a lost carry shows up immediately
+    const auto next_word = [&rng, trials]() { return (trials % 2 == 0) ? (UINT64_MAX - (rng() % 4U)) : rng(); };
+
+    const boost::int128::uint128_t a { next_word(), next_word() };
+    const boost::int128::uint128_t b { next_word(), next_word() };
+
+    const dec_intern_uint_type lhs { { next_word(), next_word() }, { next_word(), next_word() } };
+    const dec_intern_uint_type rhs { { next_word(), next_word() }, { next_word(), next_word() } };
+
+    const auto ctrl_lhs = to_ctrl(lhs);
+    const auto ctrl_rhs = to_ctrl(rhs);
+
+    const boost_ctrl_uint_type ctrl_product = boost_ctrl_uint_type(to_ctrl(dec_intern_uint_type { a })) * to_ctrl(dec_intern_uint_type { b });
+
+    BOOST_TEST(to_ctrl(boost::decimal::detail::umul256(a, b)) == ctrl_product);
+    BOOST_TEST(to_ctrl(lhs * rhs) == boost_ctrl_uint_type(ctrl_lhs * ctrl_rhs));
+    BOOST_TEST(to_ctrl(lhs * a) == boost_ctrl_uint_type(ctrl_lhs * to_ctrl(dec_intern_uint_type { a })));
+    BOOST_TEST(to_ctrl(lhs * a.low) == boost_ctrl_uint_type(ctrl_lhs * a.low));
+    BOOST_TEST(to_ctrl(lhs + rhs) == boost_ctrl_uint_type(ctrl_lhs + ctrl_rhs));
+    BOOST_TEST(to_ctrl(lhs - rhs) == boost_ctrl_uint_type(ctrl_lhs - ctrl_rhs));
+  }
+
+  // The portable kernels are used in constant expressions
+  constexpr boost::int128::uint128_t max_128 { UINT64_MAX, UINT64_MAX };
+  constexpr auto max_square = boost::decimal::detail::umul256(max_128, max_128);
+  static_assert(max_square[3] == UINT64_MAX && max_square[2] == UINT64_MAX - 1U && max_square[1] == 0U && max_square[0] == 1U, "Wrong product");
+}
+
+// Divisors of every word count with full range and near-max words,
+// so that the quotient estimates of the reciprocal division are corrected in both directions
+auto test_full_range_div_mod() -> void
+{
+  using boost_ctrl_uint_type = boost::multiprecision::uint256_t;
+  using dec_intern_uint_type = boost::decimal::detail::u256;
+
+  std::mt19937_64 rng(local::time_point<std::mt19937_64::result_type>());
+
+  const auto to_ctrl = [](const dec_intern_uint_type& x)
+  {
+    boost_ctrl_uint_type result { 0 };
+    for(auto index = static_cast<int>(INT8_C(3)); index >= 0; --index)
+    {
+      result <<= 64;
+      result |= x[static_cast<std::size_t>(index)];
+    }
+    return result;
+  };
+
+  for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT16_C(0x1000)); ++trials)
+  {
+    const auto next_word = [&rng, trials]()
+    {
+      switch (trials % 4)
+      {
+        case 0:
+          return UINT64_MAX - (rng() % 4U);
+        case 1:
+          return rng() % 4U;
+        default:
+          return rng();
+      }
+    };
+
+    dec_intern_uint_type lhs { { next_word(), next_word() }, { next_word(), next_word() } };
+    dec_intern_uint_type rhs { { next_word(), next_word() }, { next_word(), next_word() } };
+
+    // Keep between one and four words of the divisor, and shift it by a random amount
+    const auto rhs_words = static_cast<std::size_t>(1U + (static_cast<unsigned>(trials) / 4U) % 4U);
+    for(auto index = rhs_words; index < 4U; ++index)
+    {
+      rhs[index] = 0U;
+    }
+    rhs >>= static_cast<int>(rng() % 64U);
+
+    if(rhs == 0U)
+    {
+      rhs = dec_intern_uint_type { UINT64_C(1) };
+    }
+
+    // A three word divisor and a partial remainder whose top two words equal those of the divisor,
+    // which forces the largest quotient word estimate
+    if(trials % 16 == 3)
+    {
+      const auto low_word = UINT64_MAX - (rng() % 4U);
+      rhs = dec_intern_uint_type { 0U, UINT64_C(0x4000000000000000) | (rng() >> 2U), rng(), low_word };
+
+      dec_intern_uint_type partial_remainder { rhs };
+      partial_remainder[0] = low_word - 1U;
+
+      lhs = ((rhs + partial_remainder) << 64) | dec_intern_uint_type { rng() };
+    }
+
+    const auto ctrl_lhs = to_ctrl(lhs);
+    const auto ctrl_rhs = to_ctrl(rhs);
+
+    const auto res = boost::decimal::detail::impl::div_mod(lhs, rhs);
+
+    BOOST_TEST(to_ctrl(res.quotient) == boost_ctrl_uint_type(ctrl_lhs / ctrl_rhs));
+    BOOST_TEST(to_ctrl(res.remainder) == boost_ctrl_uint_type(ctrl_lhs % ctrl_rhs));
+    BOOST_TEST(to_ctrl(lhs / rhs) == boost_ctrl_uint_type(ctrl_lhs / ctrl_rhs));
+    BOOST_TEST(to_ctrl(lhs % rhs) == boost_ctrl_uint_type(ctrl_lhs % ctrl_rhs));
+
+    if(rhs[0] != 0U)
+    {
+      BOOST_TEST(to_ctrl(lhs / rhs[0]) == boost_ctrl_uint_type(ctrl_lhs / rhs[0]));
+      BOOST_TEST(to_ctrl(lhs % rhs[0]) == boost_ctrl_uint_type(ctrl_lhs % rhs[0]));
+    }
+
+    const boost::int128::uint128_t rhs_128 { rhs[1], rhs[0] };
+    if(rhs_128 != 0U)
+    {
+      BOOST_TEST(to_ctrl(lhs / rhs_128) == boost_ctrl_uint_type(ctrl_lhs / to_ctrl(dec_intern_uint_type { rhs_128 })));
+    }
+  }
+
+  // The division kernels are used in constant expressions
+  constexpr dec_intern_uint_type max_256 { UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX };
+  constexpr dec_intern_uint_type divisor { 0U, 0U, UINT64_C(0x8000000000000000), 1U };
+  constexpr auto res = boost::decimal::detail::impl::div_mod(max_256, divisor);
+  // (2^256 - 1) = (2^127 + 1) * (2^129 - 4) + 3
+  static_assert(res.quotient[3] == 0U && res.quotient[2] == 1U && res.quotient[1] == UINT64_MAX && res.quotient[0] == UINT64_MAX - 3U, "Wrong quotient");
+  static_assert(res.remainder[3] == 0U && res.remainder[2] == 0U && res.remainder[1] == 0U && res.remainder[0] == 3U, "Wrong remainder");
+}
+
+// Every power of ten with full range and near-max dividends, against the long division
+auto test_div_pow10() -> void
+{
+  using boost_ctrl_uint_type = boost::multiprecision::uint256_t;
+  using dec_intern_uint_type = boost::decimal::detail::u256;
+
+  std::mt19937_64 rng(local::time_point<std::mt19937_64::result_type>());
+
+  const auto to_ctrl = [](const dec_intern_uint_type& x)
+  {
+    boost_ctrl_uint_type result { 0 };
+    for(auto index = static_cast<int>(INT8_C(3)); index >= 0; --index)
+    {
+      result <<= 64;
+      result |= x[static_cast<std::size_t>(index)];
+    }
+    return result;
+  };
+
+  // The precomputed reciprocals are the ones the divisor itself would compute
+  for(auto k = static_cast<int>(INT8_C(0)); k <= static_cast<int>(INT8_C(38)); ++k)
+  {
+    const boost::decimal::detail::invariant_divisor div { boost::decimal::detail::pow10(static_cast<boost::int128::uint128_t>(k)) };
+    const auto& entry = boost::decimal::detail::impl::pow10_divisors[k];
+
+    BOOST_TEST(entry.d == div.d);
+    BOOST_TEST_EQ(entry.v, div.v);
+    BOOST_TEST_EQ(entry.shift, div.shift);
+    BOOST_TEST_EQ(entry.is_wide, div.is_wide);
+  }
+
+  for(auto trials = static_cast<int>(INT8_C(0)); trials < static_cast<int>(INT16_C(0x100)); ++trials)
+  {
+    const auto next_word = [&rng, trials]() { return (trials % 2 == 0) ? (UINT64_MAX - (rng() % 4U)) : rng(); };
+
+    const dec_intern_uint_type lhs { { next_word(), next_word() }, { next_word(), next_word() } };
+    const boost::int128::uint128_t lhs_128 { next_word(), next_word() };
+
+    for(auto k = static_cast<int>(INT8_C(0)); k <= static_cast<int>(INT8_C(77)); ++k)
+    {
+      const auto pow_ten = boost::decimal::detail::pow10(static_cast<dec_intern_uint_type>(k));
+
+      BOOST_TEST(to_ctrl(boost::decimal::detail::div_pow10(lhs, k)) == boost_ctrl_uint_type(to_ctrl(lhs) / to_ctrl(pow_ten)));
+
+      if(k <= 38)
+      {
+        const auto ctrl_128 = lhs_128 / static_cast<boost::int128::uint128_t>(pow_ten);
+
+        // div_pow10 may prefer the builtin division, so the reciprocals are checked on their own as well
+        BOOST_TEST(boost::decimal::detail::div_pow10(lhs_128, k) == ctrl_128);
+        BOOST_TEST(boost::decimal::detail::invariant_div(lhs_128, boost::decimal::detail::impl::pow10_divisors[k]) == ctrl_128);
+      }
+    }
+
+    // 10^78 is past the range of u256
+    BOOST_TEST(boost::decimal::detail::div_pow10(lhs, 78) == 0U);
+  }
 }
 
 int main()
 {
+  test_div_mod_single_word_divisor();
+  test_full_range_mul_add();
+  test_full_range_div_mod();
+  test_div_pow10();
+
   #ifndef __s390x__
   test_big_uints_mul<boost::multiprecision::uint128_t, boost::int128::uint128_t  >();
   test_big_uints_mul<boost::multiprecision::uint256_t, boost::decimal::detail::u256>();
@@ -496,6 +785,15 @@ int main()
 
   test_digit_counting<boost::int128::uint128_t>();
   test_digit_counting<boost::decimal::detail::u256>();
+
+  test_digit_counting_bit_widths<std::uint32_t, std::uint32_t>();
+  test_digit_counting_bit_widths<std::uint64_t, std::uint64_t>();
+  test_digit_counting_bit_widths<boost::multiprecision::uint128_t, boost::int128::uint128_t  >();
+  test_digit_counting_bit_widths<boost::multiprecision::uint256_t, boost::decimal::detail::u256>();
+
+  static_assert(boost::decimal::detail::num_digits(UINT32_C(4294967295)) == 10, "Wrong number of digits");
+  static_assert(boost::decimal::detail::num_digits(UINT64_C(9999999999999999999)) == 19, "Wrong number of digits");
+  static_assert(boost::decimal::detail::num_digits(boost::int128::uint128_t { UINT64_C(1), UINT64_C(0) }) == 20, "Wrong number of digits");
   #endif
 
   test_big_uints_div<boost::multiprecision::uint128_t, boost::int128::uint128_t  >();
@@ -0,0 +1,145 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_COMPACT_FAST128
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static_assert(sizeof(decimal_fast128_t) == 16U, "The compact layout is a single 128-bit word");
+
+static constexpr std::size_t N = 1024;
+
+// Significands of 32 digits, which the division below is compared against within an epsilon of
+decimal128_t random_wide_value(const int min_exp, const int max_exp)
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist {0U, UINT64_C(9999999999999999)};
+    std::uniform_int_distribution<int> exp_dist {min_exp, max_exp};
+    std::uniform_int_distribution<int> sign_dist {0, 1};
+
+    const boost::int128::uint128_t sig {sig_dist(rng) * UINT64_C(10000000000000000) + sig_dist(rng)};
+    return decimal128_t{sig, exp_dist(rng), sign_dist(rng) == 1};
+}
+
+// The compact layout must give the same results as decimal128_t
+void check_same(const decimal_fast128_t lhs, const decimal128_t rhs)
+{
+    if (isnan(rhs))
+    {
+        BOOST_TEST(isnan(lhs));
+    }
+    else
+    {
+        BOOST_TEST_EQ(static_cast<decimal128_t>(lhs), rhs);
+        BOOST_TEST_EQ(signbit(lhs), signbit(rhs));
+        BOOST_TEST_EQ(isinf(lhs), isinf(rhs));
+        BOOST_TEST_EQ(isnormal(lhs), isnormal(rhs));
+    }
+}
+
+void test_arithmetic(const int min_exp, const int max_exp)
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_wide_value(min_exp, max_exp)};
+        const auto rhs {random_wide_value(min_exp, max_exp)};
+        const auto fast_lhs {static_cast<decimal_fast128_t>(lhs)};
+        const auto fast_rhs {static_cast<decimal_fast128_t>(rhs)};
+
+        check_same(fast_lhs, lhs);
+        check_same(-fast_lhs, -lhs);
+        check_same(fast_lhs + fast_rhs, lhs + rhs);
+        check_same(fast_lhs - fast_rhs, lhs - rhs);
+        check_same(fast_lhs * fast_rhs, lhs * rhs);
+
+        // The fast division may differ from decimal128_t in the last digit
+        const auto quotient {lhs / rhs};
+        const auto fast_quotient {static_cast<decimal128_t>(fast_lhs / fast_rhs)};
+        BOOST_TEST(abs(fast_quotient - quotient) <= abs(quotient) * std::numeric_limits<decimal128_t>::epsilon());
+
+        check_same(copysign(fast_lhs, fast_rhs), copysign(lhs, rhs));
+        check_same(scalbn(fast_lhs, 3), scalbn(lhs, 3));
+
+        BOOST_TEST_EQ(fast_lhs == fast_rhs, lhs == rhs);
+        BOOST_TEST_EQ(fast_lhs < fast_rhs, lhs < rhs);
+        BOOST_TEST_EQ(fast_rhs < fast_lhs, rhs < lhs);
+        BOOST_TEST_EQ(fast_lhs < -fast_lhs, lhs < -lhs);
+    }
+}
+
+void test_limits()
+{
+    using fast_limits = std::numeric_limits<decimal_fast128_t>;
+    using ieee_limits = std::numeric_limits<decimal128_t>;
+
+    check_same(fast_limits::max(), ieee_limits::max());
+    check_same(fast_limits::lowest(), ieee_limits::lowest());
+    check_same(fast_limits::min(), ieee_limits::min());
+    check_same(fast_limits::epsilon(), ieee_limits::epsilon());
+    check_same(fast_limits::max() * decimal_fast128_t{10}, ieee_limits::max() * decimal128_t{10});
+    check_same(-fast_limits::max() * decimal_fast128_t{10}, -ieee_limits::max() * decimal128_t{10});
+
+    const decimal_fast128_t zero {0};
+    BOOST_TEST_EQ(zero, -zero);
+    BOOST_TEST(!signbit(zero));
+    BOOST_TEST(signbit(-zero));
+    BOOST_TEST(!(zero < -zero));
+    BOOST_TEST(-zero < fast_limits::denorm_min());
+}
+
+void test_non_finite()
+{
+    using fast_limits = std::numeric_limits<decimal_fast128_t>;
+
+    const auto inf {fast_limits::infinity()};
+    const auto qnan {fast_limits::quiet_NaN()};
+    const auto snan {fast_limits::signaling_NaN()};
+
+    BOOST_TEST(isinf(inf) && isinf(-inf));
+    BOOST_TEST(!isnan(inf) && !isfinite(inf));
+    BOOST_TEST(signbit(-inf) && !signbit(inf));
+    BOOST_TEST(-inf < fast_limits::lowest());
+    BOOST_TEST(fast_limits::max() < inf);
+
+    BOOST_TEST(isnan(qnan) && isnan(-qnan));
+    BOOST_TEST(!issignaling(qnan) && !issignaling(-qnan));
+    BOOST_TEST(issignaling(snan) && issignaling(-snan));
+    BOOST_TEST(!isinf(qnan) && !isinf(snan) && !isfinite(qnan));
+    BOOST_TEST(signbit(-qnan));
+    BOOST_TEST(qnan != qnan);
+
+    BOOST_TEST(isinf(fast_limits::max() + fast_limits::max()));
+    BOOST_TEST(isnan(inf - inf));
+    BOOST_TEST(isinf(decimal_fast128_t{1} / decimal_fast128_t{0}));
+    BOOST_TEST(isinf(decimal_fast128_t{1, 10000}));
+    BOOST_TEST(isinf(decimal_fast128_t{std::numeric_limits<double>::infinity()}));
+    BOOST_TEST(isnan(decimal_fast128_t{std::numeric_limits<double>::quiet_NaN()}));
+
+    // Payloads are stored in the significand bits below the exponent
+    const auto payload_qnan {nand128f("12345")};
+    BOOST_TEST(isnan(payload_qnan) && !issignaling(payload_qnan));
+    BOOST_TEST_EQ(read_payload(payload_qnan), 12345U);
+    BOOST_TEST_EQ(read_payload(-payload_qnan), 12345U);
+
+    // 2^104 reaches into the high word of the significand
+    const auto payload_snan {snand128f("20282409603651670423947251286016")};
+    BOOST_TEST(issignaling(payload_snan));
+    BOOST_TEST(read_payload(payload_snan) == (boost::int128::uint128_t{UINT64_C(1) << 40U, 0U}));
+}
+
+int main()
+{
+    test_arithmetic(-20, 20);
+    test_arithmetic(-3000, 3000);
+    test_limits();
+    test_non_finite();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+// Exact cancellation gives +0 in every rounding mode, while IEEE 754 gives -0 when rounding downward
+void check_sum(const decimal128_t lhs, const decimal128_t rhs)
+{
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    if (lhs == 0 && boost::decimal::fegetround() == rounding_mode::fe_dec_downward)
+    {
+        BOOST_TEST_EQ(lhs, rhs);
+        return;
+    }
+    #endif
+
+    check_same(lhs, rhs);
+}
+
+// The exactly rounded sum, computed without going through operator+
+template <typename DecimalType>
+DecimalType reference_sum(const DecimalType lhs, const DecimalType rhs)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc += lhs;
+    acc += rhs;
+    return acc.result();
+}
+
+std::uint64_t random_significand(const int digits)
+{
+    std::uint64_t max_sig {1};
+    for (int i {}; i < digits; ++i)
+    {
+        max_sig *= 10U;
+    }
+
+    std::uniform_int_distribution<std::uint64_t> sig_dist {0U, max_sig - 1U};
+    return sig_dist(rng);
+}
+
+// Significands of differing lengths with nearby exponents, most of which are added in 64-bit integers
+void test_random(const int base_exp, const int max_digits, const int exp_range)
+{
+    std::uniform_int_distribution<int> digit_dist {1, max_digits};
+    std::uniform_int_distribution<int> exp_dist {base_exp, base_exp + exp_range};
+    std::uniform_int_distribution<int> sign_dist {0, 1};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const decimal128_t lhs {random_significand(digit_dist(rng)), exp_dist(rng), sign_dist(rng) == 1};
+        const decimal128_t rhs {random_significand(digit_dist(rng)), exp_dist(rng), sign_dist(rng) == 1};
+
+        check_sum(lhs + rhs, reference_sum(lhs, rhs));
+        check_sum(lhs - rhs, reference_sum(lhs, -rhs));
+    }
+}
+
+void test_boundaries()
+{
+    // Aligned values of exactly 18 digits, and the first which do not fit
+    const decimal128_t max_narrow {UINT64_C(999999999999999999), 0};
+    const decimal128_t shifted {UINT64_C(99999999999999999), 1};
+    const decimal128_t wide {UINT64_C(9999999999999999999), 0};
+    check_sum(max_narrow + max_narrow, reference_sum(max_narrow, max_narrow));
+    check_sum(max_narrow - shifted, reference_sum(max_narrow, -shifted));
+    check_sum(shifted + decimal128_t{1, -1}, reference_sum(shifted, decimal128_t{1, -1}));
+    check_sum(wide + max_narrow, reference_sum(wide, max_narrow));
+
+    // Cancellation, and zeros which are left to the general path
+    const decimal128_t val {12345, -2};
+    check_sum(val - decimal128_t{1234500, -4}, decimal128_t{0});
+    check_sum(val + decimal128_t{0, -10}, val);
+    check_sum(-decimal128_t{0} - val, -val);
+
+    // Sums near the limits of the exponent range
+    const auto max {std::numeric_limits<decimal128_t>::max()};
+    const decimal128_t big {UINT64_C(9999999999), 6102};
+    check_sum(big + decimal128_t{UINT64_C(5), 6110}, reference_sum(big, decimal128_t{UINT64_C(5), 6110}));
+    check_sum(max + decimal128_t{1, 6110}, reference_sum(max, decimal128_t{1, 6110}));
+
+    const decimal128_t tiny {123, -6176};
+    check_sum(tiny + tiny, reference_sum(tiny, tiny));
+    check_sum(tiny - decimal128_t{1, -6174}, reference_sum(tiny, -decimal128_t{1, -6174}));
+}
+
+void test()
+{
+    test_random(-4, 9, 2);
+    test_random(-10, 18, 8);
+    test_random(-6176, 12, 6);
+    test_random(6100, 12, 6);
+    test_boundaries();
+}
+
+int main()
+{
+    test();
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    const auto mode {boost::decimal::fegetround()};
+
+    for (const auto round : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                             rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward})
+    {
+        boost::decimal::fesetround(round);
+        test();
+    }
+
+    boost::decimal::fesetround(mode);
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+// The exactly rounded product, computed without going through operator*
+template <typename DecimalType>
+DecimalType reference_product(const DecimalType lhs, const DecimalType rhs)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc.add_product(lhs, rhs);
+    return acc.result();
+}
+
+std::uint64_t random_significand(const int digits)
+{
+    std::uint64_t max_sig {1};
+    for (int i {}; i < digits; ++i)
+    {
+        max_sig *= 10U;
+    }
+
+    std::uniform_int_distribution<std::uint64_t> sig_dist {max_sig / 10U, max_sig - 1U};
+    return sig_dist(rng);
+}
+
+// Significands of up to 19 digits, whose products have up to 38 digits
+template <typename DecimalType>
+void test_random(const int min_exp, const int max_exp)
+{
+    std::uniform_int_distribution<int> digit_dist {1, 19};
+    std::uniform_int_distribution<int> exp_dist {min_exp, max_exp};
+    std::uniform_int_distribution<int> sign_dist {0, 1};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const DecimalType lhs {random_significand(digit_dist(rng)), exp_dist(rng), sign_dist(rng) == 1};
+        const DecimalType rhs {random_significand(digit_dist(rng)), exp_dist(rng), sign_dist(rng) == 1};
+
+        check_same(lhs * rhs, reference_product(lhs, rhs));
+    }
+}
+
+template <typename DecimalType>
+void test_boundaries()
+{
+    // The largest 64-bit significand, and products on either side of 34 digits
+    const DecimalType max_u64 {(std::numeric_limits<std::uint64_t>::max)(), 0};
+    check_same(max_u64 * max_u64, reference_product(max_u64, max_u64));
+
+    const DecimalType lhs {UINT64_C(99999999999999999), -5};
+    const DecimalType rhs {UINT64_C(99999999999999999), 3};
+    check_same(lhs * rhs, reference_product(lhs, rhs));
+
+    const DecimalType wide {UINT64_C(999999999999999999), -5};
+    check_same(lhs * wide, reference_product(lhs, wide));
+    check_same(-wide * rhs, reference_product(-wide, rhs));
+
+    // Overflow, underflow into the subnormals, and signed zeros
+    const DecimalType big {UINT64_C(1234567890123), 6000};
+    const DecimalType small {UINT64_C(1234567890123), -6100};
+    check_same(big * big, std::numeric_limits<DecimalType>::infinity());
+    check_same(-big * big, -std::numeric_limits<DecimalType>::infinity());
+    check_same(small * small, reference_product(small, small));
+    check_same(small * DecimalType{7, -70}, reference_product(small, DecimalType{7, -70}));
+    check_same(DecimalType{0} * -big, -DecimalType{0});
+    check_same(-small * DecimalType{0}, -DecimalType{0});
+}
+
+template <typename DecimalType>
+void test()
+{
+    test_random<DecimalType>(-20, 20);
+    test_random<DecimalType>(-3200, 3200);
+    test_boundaries<DecimalType>();
+
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    const auto mode {boost::decimal::fegetround()};
+
+    for (const auto round : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                             rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward})
+    {
+        boost::decimal::fesetround(round);
+        test_random<DecimalType>(-20, 20);
+        test_boundaries<DecimalType>();
+    }
+
+    boost::decimal::fesetround(mode);
+    #endif
+}
+
+int main()
+{
+    test<decimal128_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,370 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+// The sum of the values computed in decimal128_t, which is exact as long as it fits in 34 digits
+template <typename DecimalType>
+decimal128_t wide_sum(const std::vector<DecimalType>& values)
+{
+    decimal128_t sum {0};
+    for (const auto val : values)
+    {
+        sum += static_cast<decimal128_t>(val);
+    }
+
+    return sum;
+}
+
+template <typename DecimalType>
+void test_exact_sums()
+{
+    // Sums that need more digits than DecimalType has are rounded once
+    std::int64_t max_sig {1};
+    for (int i {}; i < (std::min)(std::numeric_limits<DecimalType>::digits10, 15); ++i)
+    {
+        max_sig *= 10;
+    }
+    --max_sig;
+
+    for (const auto range : {0, 3, 8})
+    {
+        const auto values {generate_values<DecimalType>(N, -4, -4 + range, max_sig)};
+
+        decimal_accumulator<DecimalType> acc {};
+        acc.accumulate(values.data(), values.size());
+        check_same(acc.result(), static_cast<DecimalType>(wide_sum(values)));
+
+        decimal_accumulator<DecimalType> element_wise {};
+        for (const auto val : values)
+        {
+            element_wise += val;
+        }
+        check_same(element_wise.result(), acc.result());
+
+        // Partial sums can be merged in any order
+        decimal_accumulator<DecimalType> merged {};
+        for (std::size_t part {}; part < 4U; ++part)
+        {
+            decimal_accumulator<DecimalType> partial {};
+            partial.accumulate(values.data() + part * N / 4U, N / 4U);
+            merged.merge(partial);
+        }
+        check_same(merged.result(), acc.result());
+
+        // Subtracting everything again gives an exact zero
+        for (const auto val : values)
+        {
+            acc -= val;
+        }
+        check_same(acc.result(), DecimalType{0});
+    }
+}
+
+template <typename DecimalType>
+void test_no_intermediate_rounding()
+{
+    // Each step of the operator loop rounds 0.5 away as a tie to even
+    const auto big {DecimalType{1, std::numeric_limits<DecimalType>::digits10}};
+    const DecimalType half {5, -1};
+
+    decimal_accumulator<DecimalType> acc {};
+    acc += big;
+    auto scalar {big};
+    for (int i {}; i < 10; ++i)
+    {
+        acc += half;
+        scalar += half;
+    }
+
+    check_same(scalar, big);
+    check_same(acc.result(), big + DecimalType{5});
+
+    // Large terms that cancel exactly do not lose the small ones
+    decimal_accumulator<DecimalType> cancel {};
+    cancel += DecimalType{1, 40};
+    cancel += DecimalType{3, -2};
+    cancel += DecimalType{-1, 40};
+    check_same(cancel.result(), DecimalType{3, -2});
+
+    // Terms far below the precision of the result still round correctly
+    decimal_accumulator<DecimalType> tiny {};
+    tiny += std::numeric_limits<DecimalType>::max();
+    tiny += std::numeric_limits<DecimalType>::denorm_min();
+    check_same(tiny.result(), std::numeric_limits<DecimalType>::max());
+
+    // The overflowing sum is an infinity
+    tiny += std::numeric_limits<DecimalType>::max();
+    check_same(tiny.result(), std::numeric_limits<DecimalType>::infinity());
+}
+
+// Digits that are dropped below the running sum have to be combined with their signs
+template <typename DecimalType>
+void test_dropped_digits()
+{
+    constexpr auto digits {std::numeric_limits<DecimalType>::digits10};
+
+    // An odd significand with a tie below it, which rounds up to even unless something is subtracted
+    const auto odd {DecimalType{1, digits - 1 + 65} + DecimalType{1, 65}};
+    const auto even {odd + DecimalType{1, 65}};
+    const DecimalType tie {5, 64};
+
+    const std::vector<std::pair<std::vector<DecimalType>, DecimalType>> cases {
+        {{DecimalType{1, -10}, DecimalType{-2, -10}, odd, tie}, odd},
+        {{DecimalType{-2, -10}, odd, DecimalType{1, -10}, tie}, odd},
+        {{DecimalType{1, -10}, odd, tie}, even},
+        {{DecimalType{-1, -10}, odd, tie}, odd},
+        {{odd, tie}, even},
+        {{DecimalType{2, -10}, DecimalType{-1, -10}, -odd, -tie}, -odd},
+    };
+
+    for (const auto& test_case : cases)
+    {
+        auto values {test_case.first};
+        std::sort(values.begin(), values.end());
+
+        do
+        {
+            decimal_accumulator<DecimalType> acc {};
+            acc.accumulate(values.data(), values.size());
+            check_same(acc.result(), test_case.second);
+
+            // Every split between two accumulators that are merged afterwards
+            for (std::size_t split {}; split <= values.size(); ++split)
+            {
+                decimal_accumulator<DecimalType> lhs {};
+                decimal_accumulator<DecimalType> rhs {};
+                lhs.accumulate(values.data(), split);
+                rhs.accumulate(values.data() + split, values.size() - split);
+                lhs.merge(rhs);
+                check_same(lhs.result(), test_case.second);
+            }
+        } while (std::next_permutation(values.begin(), values.end()));
+    }
+
+    // Values that span far more digits than the running sum keeps give the same result in any order and split
+    auto values {generate_values<DecimalType>(N, -60, 60, 9999999)};
+    const auto count {values.size()};
+    for (std::size_t i {}; i < count; ++i)
+    {
+        values.push_back(-values[i] * DecimalType{1, 5});
+    }
+
+    decimal_accumulator<DecimalType> expected {};
+    expected.accumulate(values.data(), values.size());
+
+    for (int i {}; i < 8; ++i)
+    {
+        std::shuffle(values.begin(), values.end(), rng);
+        const auto split {std::uniform_int_distribution<std::size_t>{0U, values.size()}(rng)};
+
+        decimal_accumulator<DecimalType> lhs {};
+        decimal_accumulator<DecimalType> rhs {};
+        lhs.accumulate(values.data(), split);
+        rhs.accumulate(values.data() + split, values.size() - split);
+        check_same(rhs.merge(lhs).result(), expected.result());
+    }
+}
+
+template <typename DecimalType>
+void test_special_values()
+{
+    const auto inf {std::numeric_limits<DecimalType>::infinity()};
+    const auto qnan {std::numeric_limits<DecimalType>::quiet_NaN()};
+    const auto one {DecimalType{1}};
+
+    decimal_accumulator<DecimalType> empty {};
+    check_same(empty.result(), DecimalType{0});
+
+    const std::vector<std::vector<DecimalType>> cases {
+        {one, inf, one},
+        {one, -inf, one},
+        {inf, one, -inf},
+        {one, qnan, inf},
+        {std::numeric_limits<DecimalType>::signaling_NaN(), one},
+        {DecimalType{0}, -DecimalType{0}},
+        {-DecimalType{0}, -DecimalType{0}},
+        {one, -one},
+    };
+
+    for (const auto& values : cases)
+    {
+        decimal_accumulator<DecimalType> acc {};
+        acc.accumulate(values.data(), values.size());
+
+        auto scalar {values[0]};
+        for (std::size_t i {1}; i < values.size(); ++i)
+        {
+            scalar += values[i];
+        }
+
+        check_same(acc.result(), scalar);
+    }
+
+    // An exact zero sum of opposite signs is -0 when rounding downward
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    const auto mode {boost::decimal::fegetround()};
+    boost::decimal::fesetround(rounding_mode::fe_dec_downward);
+
+    decimal_accumulator<DecimalType> acc {};
+    acc += one;
+    acc -= one;
+    check_same(acc.result(), -DecimalType{0});
+
+    boost::decimal::fesetround(mode);
+    #endif
+
+    // Non-finite values are carried through merges
+    decimal_accumulator<DecimalType> lhs {};
+    lhs += one;
+    decimal_accumulator<DecimalType> rhs {};
+    rhs += -inf;
+    lhs.merge(rhs);
+    check_same(lhs.result(), -inf);
+
+    lhs.clear();
+    check_same(lhs.result(), DecimalType{0});
+}
+
+template <typename DecimalType>
+void test_dot()
+{
+    // Keep the exact dot product within the 34 digits of decimal128_t
+    std::int64_t max_sig {1};
+    for (int i {}; i < (std::min)(std::numeric_limits<DecimalType>::digits10, 10); ++i)
+    {
+        max_sig *= 10;
+    }
+    --max_sig;
+
+    for (const auto range : {0, 2, 5})
+    {
+        const auto a {generate_values<DecimalType>(N, -3, -3 + range, max_sig)};
+        const auto b {generate_values<DecimalType>(N, -2, -2 + range, max_sig)};
+        const DecimalType init {generate_values<DecimalType>(1, -4, 4, max_sig)[0]};
+
+        decimal128_t wide {0};
+        for (std::size_t i {}; i < N; ++i)
+        {
+            wide = fma(static_cast<decimal128_t>(a[i]), static_cast<decimal128_t>(b[i]), wide);
+        }
+
+        check_same(dot(a.data(), b.data(), N), static_cast<DecimalType>(wide));
+        check_same(fma_reduce(a.data(), b.data(), N, init), static_cast<DecimalType>(wide + static_cast<decimal128_t>(init)));
+
+        decimal_accumulator<DecimalType> acc {};
+        for (std::size_t i {}; i < N; ++i)
+        {
+            acc.add_product(a[i], b[i]);
+        }
+        check_same(acc.result(), static_cast<DecimalType>(wide));
+
+        #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+        check_same(dot(std::span<const DecimalType>(a), std::span<const DecimalType>(b)), static_cast<DecimalType>(wide));
+        check_same(dot(a, b), static_cast<DecimalType>(wide));
+
+        // Spans of mutable values and vectors are deduced and converted as well
+        auto mutable_a {a};
+        auto mutable_b {b};
+        check_same(dot(std::span<DecimalType>(mutable_a), b), static_cast<DecimalType>(wide));
+        check_same(fma_reduce(a, std::span<DecimalType>(mutable_b), init), static_cast<DecimalType>(wide + static_cast<decimal128_t>(init)));
+
+        decimal_accumulator<DecimalType> span_acc {};
+        span_acc.accumulate_products(a, std::span<DecimalType>(mutable_b));
+        check_same(span_acc.result(), static_cast<DecimalType>(wide));
+        #endif
+    }
+
+    // The products are not rounded before they are added
+    const DecimalType big {1, std::numeric_limits<DecimalType>::digits10};
+    const std::vector<DecimalType> lhs {big, DecimalType{5, -1}, DecimalType{5, -1}};
+    const std::vector<DecimalType> rhs {DecimalType{1}, DecimalType{1}, DecimalType{1}};
+    check_same(dot(lhs.data(), rhs.data(), lhs.size()), big + DecimalType{1});
+    check_same(fma_reduce(lhs.data(), rhs.data(), lhs.size(), -big), DecimalType{1});
+
+    // Products far below the others cancel exactly before the tie is rounded, in any order
+    constexpr auto digits {std::numeric_limits<DecimalType>::digits10};
+    const auto odd {DecimalType{1, digits - 1 + 30} + DecimalType{1, 30}};
+    std::vector<std::pair<DecimalType, DecimalType>> products {
+        {DecimalType{1, -5}, DecimalType{1, -5}},
+        {DecimalType{-2, -5}, DecimalType{1, -5}},
+        {odd, DecimalType{1, 35}},
+        {DecimalType{5, 32}, DecimalType{1, 32}},
+    };
+    std::sort(products.begin(), products.end());
+
+    do
+    {
+        std::vector<DecimalType> x {};
+        std::vector<DecimalType> y {};
+        for (const auto& product : products)
+        {
+            x.push_back(product.first);
+            y.push_back(product.second);
+        }
+
+        check_same(dot(x.data(), y.data(), x.size()), odd * DecimalType{1, 35});
+        check_same(fma_reduce(x.data(), y.data(), x.size(), DecimalType{-1, digits - 1 + 65}), DecimalType{15, 64});
+        check_same(fma_reduce(x.data(), y.data(), x.size(), DecimalType{2, -10}), odd * DecimalType{1, 35} + DecimalType{1, 65});
+    } while (std::next_permutation(products.begin(), products.end()));
+
+    // Empty ranges
+    check_same(dot(lhs.data(), rhs.data(), 0U), DecimalType{0});
+    check_same(fma_reduce(lhs.data(), rhs.data(), 0U, big), big);
+
+    // Non-finite values give the same results as the scalar loop
+    const auto inf {std::numeric_limits<DecimalType>::infinity()};
+    const auto qnan {std::numeric_limits<DecimalType>::quiet_NaN()};
+    const std::vector<std::vector<DecimalType>> cases {
+        {DecimalType{2}, inf, DecimalType{3}},
+        {DecimalType{2}, -inf, DecimalType{3}},
+        {DecimalType{0}, inf, DecimalType{3}},
+        {DecimalType{2}, qnan, DecimalType{3}},
+    };
+
+    for (const auto& values : cases)
+    {
+        DecimalType scalar {0};
+        for (const auto val : values)
+        {
+            scalar += val * DecimalType{-4};
+        }
+
+        const std::vector<DecimalType> factors(values.size(), DecimalType{-4});
+        check_same(dot(values.data(), factors.data(), values.size()), scalar);
+    }
+}
+
+template <typename DecimalType>
+void test()
+{
+    test_exact_sums<DecimalType>();
+    test_no_intermediate_rounding<DecimalType>();
+    test_dropped_digits<DecimalType>();
+    test_special_values<DecimalType>();
+    test_dot<DecimalType>();
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,235 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+template <typename DecimalType>
+std::vector<DecimalType> with_special_values(std::vector<DecimalType> values)
+{
+    values[3] = std::numeric_limits<DecimalType>::infinity();
+    values[4] = -std::numeric_limits<DecimalType>::infinity();
+    values[70] = std::numeric_limits<DecimalType>::quiet_NaN();
+    values[500] = DecimalType{0U, 5};
+    values[501] = DecimalType{0U, -7, true};
+    values[N - 1] = std::numeric_limits<DecimalType>::max();
+
+    return values;
+}
+
+template <typename DecimalType>
+void test_conversions()
+{
+    const auto values {with_special_values(generate_values<DecimalType>(N, -20, 20))};
+
+    const decimal_column<DecimalType> column {values.data(), values.size()};
+    BOOST_TEST_EQ(column.size(), values.size());
+
+    std::vector<DecimalType> round_trip(values.size());
+    column.copy_to(round_trip.data());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        check_same_encoding(round_trip[i], values[i]);
+        check_same_encoding(column[i], values[i]);
+    }
+
+    // Lanes are aligned and hold the fields of each value
+    BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(column.significands()) % decimal_column<DecimalType>::alignment, 0U);
+    BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(column.exponents()) % decimal_column<DecimalType>::alignment, 0U);
+    BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(column.signs()) % decimal_column<DecimalType>::alignment, 0U);
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        BOOST_TEST_EQ(column.signs()[i] != 0U, signbit(values[i]));
+    }
+
+    // Converting from and to the IEEE type matches the scalar conversions
+    const auto ieee_values {with_special_values(generate_values<decimal64_t>(N, -20, 20))};
+    decimal_column<DecimalType> from_ieee {};
+    from_ieee.assign(ieee_values.data(), ieee_values.size());
+
+    std::vector<decimal64_t> ieee_round_trip(ieee_values.size());
+    from_ieee.copy_to(ieee_round_trip.data());
+
+    for (std::size_t i {}; i < ieee_values.size(); ++i)
+    {
+        check_same<DecimalType>(from_ieee[i], static_cast<DecimalType>(ieee_values[i]));
+        check_same_encoding(ieee_round_trip[i], static_cast<decimal64_t>(static_cast<DecimalType>(ieee_values[i])));
+    }
+}
+
+template <typename DecimalType>
+void test_proxies()
+{
+    decimal_column<DecimalType> column(4U);
+    BOOST_TEST_EQ(column.size(), 4U);
+    check_same<DecimalType>(column[2], DecimalType{0});
+
+    column[0] = DecimalType{125, -2};
+    column[1] = -std::numeric_limits<DecimalType>::infinity();
+    column[2] = column[0];
+    column.push_back(DecimalType{-3, 7});
+
+    check_same<DecimalType>(column[0], DecimalType{125, -2});
+    check_same<DecimalType>(column[1], -std::numeric_limits<DecimalType>::infinity());
+    check_same<DecimalType>(column[2], DecimalType{125, -2});
+    check_same<DecimalType>(column[4], DecimalType{-3, 7});
+
+    const DecimalType val {column[0]};
+    check_same_encoding(val + column[4], DecimalType{125, -2} + DecimalType{-3, 7});
+
+    column.clear();
+    BOOST_TEST(column.empty());
+}
+
+template <typename DecimalType>
+void test_arithmetic(const std::vector<DecimalType>& a, const std::vector<DecimalType>& b)
+{
+    const decimal_column<DecimalType> lhs {a.data(), a.size()};
+    const decimal_column<DecimalType> rhs {b.data(), b.size()};
+
+    auto sum {lhs};
+    sum += rhs;
+    auto difference {lhs};
+    difference -= rhs;
+    auto product {lhs};
+    product *= rhs;
+
+    const DecimalType scalar {b[0]};
+    auto scalar_sum {lhs};
+    scalar_sum += scalar;
+    auto scalar_difference {lhs};
+    scalar_difference -= scalar;
+    auto scalar_product {lhs};
+    scalar_product *= scalar;
+
+    for (std::size_t i {}; i < a.size(); ++i)
+    {
+        check_same<DecimalType>(sum[i], a[i] + b[i]);
+        check_same<DecimalType>(difference[i], a[i] - b[i]);
+        check_same<DecimalType>(product[i], a[i] * b[i]);
+        check_same<DecimalType>(scalar_sum[i], a[i] + scalar);
+        check_same<DecimalType>(scalar_difference[i], a[i] - scalar);
+        check_same<DecimalType>(scalar_product[i], a[i] * scalar);
+    }
+}
+
+template <typename DecimalType>
+void test_comparisons(const std::vector<DecimalType>& values, const DecimalType val)
+{
+    const decimal_column<DecimalType> column {values.data(), values.size()};
+
+    const auto n {values.size()};
+    std::unique_ptr<bool[]> less {new bool[n]};
+    std::unique_ptr<bool[]> less_equal {new bool[n]};
+    std::unique_ptr<bool[]> greater {new bool[n]};
+    std::unique_ptr<bool[]> greater_equal {new bool[n]};
+    std::unique_ptr<bool[]> equal {new bool[n]};
+    std::unique_ptr<bool[]> not_equal {new bool[n]};
+
+    column.less(val, less.get());
+    column.less_equal(val, less_equal.get());
+    column.greater(val, greater.get());
+    column.greater_equal(val, greater_equal.get());
+    column.equal(val, equal.get());
+    column.not_equal(val, not_equal.get());
+
+    for (std::size_t i {}; i < n; ++i)
+    {
+        BOOST_TEST_EQ(less[i], values[i] < val);
+        BOOST_TEST_EQ(less_equal[i], values[i] <= val);
+        BOOST_TEST_EQ(greater[i], values[i] > val);
+        BOOST_TEST_EQ(greater_equal[i], values[i] >= val);
+        BOOST_TEST_EQ(equal[i], values[i] == val);
+        BOOST_TEST_EQ(not_equal[i], values[i] != val);
+    }
+}
+
+template <typename DecimalType>
+void test_reductions(const std::vector<DecimalType>& values)
+{
+    const decimal_column<DecimalType> column {values.data(), values.size()};
+
+    DecimalType sum {values.empty() ? DecimalType{0} : values[0]};
+    for (std::size_t i {1}; i < values.size(); ++i)
+    {
+        sum += values[i];
+    }
+
+    auto min {std::numeric_limits<DecimalType>::quiet_NaN()};
+    auto max {std::numeric_limits<DecimalType>::quiet_NaN()};
+    for (const auto val : values)
+    {
+        if (!isnan(val))
+        {
+            min = isnan(min) || val < min ? val : min;
+            max = isnan(max) || val > max ? val : max;
+        }
+    }
+
+    check_same_encoding(column.sum(), sum);
+    check_same_encoding(column.min(), min);
+    check_same_encoding(column.max(), max);
+}
+
+template <typename DecimalType>
+void test()
+{
+    test_conversions<DecimalType>();
+    test_proxies<DecimalType>();
+
+    const auto a {generate_values<DecimalType>(N, -20, 20)};
+    const auto b {generate_values<DecimalType>(N, -20, 20)};
+    const auto special {with_special_values(generate_values<DecimalType>(N, -20, 20))};
+    const auto close {generate_values<DecimalType>(N, -3, -2, 1'000)};
+
+    test_arithmetic(a, b);
+    test_arithmetic(special, b);
+    test_arithmetic(a, special);
+    test_arithmetic(close, close);
+
+    for (const auto val : {a[7], -a[7], DecimalType{0}, -DecimalType{0}, DecimalType{0U, 9},
+                           std::numeric_limits<DecimalType>::max(), std::numeric_limits<DecimalType>::denorm_min(),
+                           std::numeric_limits<DecimalType>::infinity(), std::numeric_limits<DecimalType>::quiet_NaN()})
+    {
+        test_comparisons(a, val);
+        test_comparisons(special, val);
+        test_comparisons(close, val);
+    }
+
+    test_reductions(a);
+    test_reductions(special);
+    test_reductions(close);
+    test_reductions(std::vector<DecimalType>{});
+    test_reductions(std::vector<DecimalType>{std::numeric_limits<DecimalType>::quiet_NaN()});
+    test_reductions(std::vector<DecimalType>{DecimalType{0}, -DecimalType{0}});
+
+    // Lengths that are not a multiple of the block size
+    for (std::size_t size {1}; size < 200U; size += 7U)
+    {
+        const auto values {generate_values<DecimalType>(size, -10, 10)};
+        test_arithmetic(values, values);
+        test_comparisons(values, values[0]);
+        test_reductions(values);
+    }
+}
+
+int main()
+{
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
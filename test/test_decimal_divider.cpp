@@ -0,0 +1,174 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+template <typename DecimalType>
+void test_against_scalar(const DecimalType divisor, const std::vector<DecimalType>& values)
+{
+    const decimal_divider<DecimalType> divider {divisor};
+    check_same_encoding(divider.divisor(), divisor);
+
+    std::vector<DecimalType> quotients(values.size());
+    divider.divide(values.data(), quotients.data(), values.size());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        check_same_encoding(quotients[i], values[i] / divisor);
+        check_same_encoding(divider(values[i]), values[i] / divisor);
+    }
+}
+
+template <typename DecimalType>
+std::vector<DecimalType> divisors()
+{
+    return {
+        DecimalType{1000},                          // Share counts and small divisors
+        DecimalType{3},
+        DecimalType{-7, -1},
+        DecimalType{1},
+        DecimalType{10825, -4},
+        DecimalType{1234567, -6},                   // Divisors using all of the precision
+        DecimalType{9'999'999'999'999'999, -15},
+        DecimalType{UINT64_C(18'446'744'073'709'551'615), -19},
+        DecimalType{316'227'766'016'837} * DecimalType{316'227'766'016'837},
+        DecimalType{0U, 3},                         // Zeros
+        DecimalType{0U, -2, true},
+        std::numeric_limits<DecimalType>::max(),
+        std::numeric_limits<DecimalType>::min(),
+        std::numeric_limits<DecimalType>::denorm_min(),
+        std::numeric_limits<DecimalType>::infinity(),
+        -std::numeric_limits<DecimalType>::infinity(),
+        std::numeric_limits<DecimalType>::quiet_NaN()
+    };
+}
+
+template <typename DecimalType>
+void test_random()
+{
+    for (const auto divisor : divisors<DecimalType>())
+    {
+        test_against_scalar(divisor, generate_values<DecimalType>(N, -20, 20));
+        test_against_scalar(divisor, generate_values<DecimalType>(N, -4, 4, 1'000));
+
+        // Quotients that overflow or underflow
+        test_against_scalar(divisor, generate_values<DecimalType>(N, std::numeric_limits<DecimalType>::max_exponent10 - 30,
+                                                                     std::numeric_limits<DecimalType>::max_exponent10 - 10));
+        test_against_scalar(divisor, generate_values<DecimalType>(N, std::numeric_limits<DecimalType>::min_exponent10 - 10,
+                                                                     std::numeric_limits<DecimalType>::min_exponent10 + 10));
+    }
+
+    // Lengths that are not a multiple of the block size
+    for (std::size_t size {}; size < 200U; size += 7U)
+    {
+        test_against_scalar(DecimalType{3}, generate_values<DecimalType>(size, -10, 10));
+    }
+}
+
+template <typename DecimalType>
+void test_special_values()
+{
+    auto values {generate_values<DecimalType>(N, -20, 20)};
+
+    values[3] = std::numeric_limits<DecimalType>::infinity();
+    values[4] = -std::numeric_limits<DecimalType>::infinity();
+    values[70] = std::numeric_limits<DecimalType>::quiet_NaN();
+    values[500] = DecimalType{0U, 5};
+    values[501] = DecimalType{0U, -7, true};
+    values[N - 1] = std::numeric_limits<DecimalType>::max();
+
+    for (const auto divisor : divisors<DecimalType>())
+    {
+        test_against_scalar(divisor, values);
+    }
+}
+
+template <typename DecimalType>
+void test_rounding_modes()
+{
+    const auto values {generate_values<DecimalType>(N, -20, 20)};
+
+    for (const auto mode : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest,
+                            rounding_mode::fe_dec_to_nearest_from_zero, rounding_mode::fe_dec_toward_zero,
+                            rounding_mode::fe_dec_upward})
+    {
+        fesetround(mode);
+        for (const auto divisor : divisors<DecimalType>())
+        {
+            test_against_scalar(divisor, values);
+        }
+    }
+
+    fesetround(rounding_mode::fe_dec_default);
+}
+
+template <typename DecimalType>
+void test_in_place()
+{
+    auto values {generate_values<DecimalType>(N, -8, 8)};
+    const auto original {values};
+    const DecimalType divisor {1000};
+
+    const decimal_divider<DecimalType> divider {divisor};
+    divider.divide(values.data(), values.data(), values.size());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        check_same_encoding(values[i], original[i] / divisor);
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+void test_span()
+{
+    const auto values {generate_values<DecimalType>(N, -8, 8)};
+    std::vector<DecimalType> quotients(N);
+    const DecimalType divisor {-3, -2};
+
+    const decimal_divider<DecimalType> divider {divisor};
+    divider.divide(std::span<const DecimalType>{values}, std::span<DecimalType>{quotients});
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        check_same_encoding(quotients[i], values[i] / divisor);
+    }
+}
+
+#endif
+
+template <typename DecimalType>
+void test()
+{
+    test_random<DecimalType>();
+    test_special_values<DecimalType>();
+    test_rounding_modes<DecimalType>();
+    test_in_place<DecimalType>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span<DecimalType>();
+    #endif
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
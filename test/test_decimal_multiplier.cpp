@@ -0,0 +1,168 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+template <typename DecimalType>
+void test_against_scalar(const DecimalType rate, const std::vector<DecimalType>& values)
+{
+    const decimal_multiplier<DecimalType> multiplier {rate};
+    check_same_encoding(multiplier.rate(), rate);
+
+    std::vector<DecimalType> products(values.size());
+    multiplier.multiply(values.data(), products.data(), values.size());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        check_same_encoding(products[i], values[i] * rate);
+        check_same_encoding(multiplier(values[i]), values[i] * rate);
+    }
+}
+
+template <typename DecimalType>
+std::vector<DecimalType> rates()
+{
+    return {
+        DecimalType{10825, -4},                     // Rates with few digits
+        DecimalType{-7, -1},
+        DecimalType{1},
+        DecimalType{125, 2},
+        DecimalType{1234567, -6},                   // Rates using all of the precision
+        DecimalType{9'999'999'999'999'999, -15},
+        DecimalType{UINT64_C(18'446'744'073'709'551'615), -19},
+        DecimalType{0U, 3},                         // Zeros
+        DecimalType{0U, -2, true},
+        std::numeric_limits<DecimalType>::max(),
+        std::numeric_limits<DecimalType>::min(),
+        std::numeric_limits<DecimalType>::denorm_min(),
+        std::numeric_limits<DecimalType>::infinity(),
+        -std::numeric_limits<DecimalType>::infinity(),
+        std::numeric_limits<DecimalType>::quiet_NaN()
+    };
+}
+
+template <typename DecimalType>
+void test_random()
+{
+    for (const auto rate : rates<DecimalType>())
+    {
+        test_against_scalar(rate, generate_values<DecimalType>(N, -20, 20));
+
+        // Small significands stay exact
+        test_against_scalar(rate, generate_values<DecimalType>(N, -4, 4, 1'000));
+
+        // Products that overflow or underflow
+        test_against_scalar(rate, generate_values<DecimalType>(N, std::numeric_limits<DecimalType>::max_exponent10 - 30,
+                                                                  std::numeric_limits<DecimalType>::max_exponent10 - 10));
+        test_against_scalar(rate, generate_values<DecimalType>(N, std::numeric_limits<DecimalType>::min_exponent10 - 10,
+                                                                  std::numeric_limits<DecimalType>::min_exponent10 + 10));
+    }
+}
+
+template <typename DecimalType>
+void test_special_values()
+{
+    auto values {generate_values<DecimalType>(N, -20, 20)};
+
+    values[3] = std::numeric_limits<DecimalType>::infinity();
+    values[4] = -std::numeric_limits<DecimalType>::infinity();
+    values[70] = std::numeric_limits<DecimalType>::quiet_NaN();
+    values[500] = DecimalType{0U, 5};
+    values[501] = DecimalType{0U, -7, true};
+    values[N - 1] = std::numeric_limits<DecimalType>::max();
+
+    for (const auto rate : rates<DecimalType>())
+    {
+        test_against_scalar(rate, values);
+    }
+}
+
+template <typename DecimalType>
+void test_rounding_modes()
+{
+    const auto values {generate_values<DecimalType>(N, -20, 20)};
+
+    for (const auto mode : {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest,
+                            rounding_mode::fe_dec_to_nearest_from_zero, rounding_mode::fe_dec_toward_zero,
+                            rounding_mode::fe_dec_upward})
+    {
+        fesetround(mode);
+        for (const auto rate : rates<DecimalType>())
+        {
+            test_against_scalar(rate, values);
+        }
+    }
+
+    fesetround(rounding_mode::fe_dec_default);
+}
+
+template <typename DecimalType>
+void test_in_place()
+{
+    auto values {generate_values<DecimalType>(N, -8, 8)};
+    const auto original {values};
+    const DecimalType rate {10825, -4};
+
+    const decimal_multiplier<DecimalType> multiplier {rate};
+    multiplier.multiply(values.data(), values.data(), values.size());
+
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        check_same_encoding(values[i], original[i] * rate);
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+template <typename DecimalType>
+void test_span()
+{
+    const auto values {generate_values<DecimalType>(N, -8, 8)};
+    std::vector<DecimalType> products(N);
+    const DecimalType rate {-3, -2};
+
+    const decimal_multiplier<DecimalType> multiplier {rate};
+    multiplier.multiply(std::span<const DecimalType>{values}, std::span<DecimalType>{products});
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        check_same_encoding(products[i], values[i] * rate);
+    }
+}
+
+#endif
+
+template <typename DecimalType>
+void test()
+{
+    test_random<DecimalType>();
+    test_special_values<DecimalType>();
+    test_rounding_modes<DecimalType>();
+    test_in_place<DecimalType>();
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    test_span<DecimalType>();
+    #endif
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
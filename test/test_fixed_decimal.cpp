@@ -0,0 +1,253 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+static std::mt19937_64 rng {42};
+
+using money = fixed_decimal<2>;
+
+static_assert(sizeof(money) == sizeof(std::int64_t), "The value is only the integer");
+static_assert(sizeof(fixed_decimal<4, std::int32_t>) == sizeof(std::int32_t), "The value is only the integer");
+static_assert((money{3} + money{2}).raw() == 500, "Addition is that of the integers");
+static_assert((money::from_raw(150) * money{2}).raw() == 300, "Multiplication rescales the product");
+
+template <typename Fixed>
+Fixed random_value(const typename Fixed::rep_type max_raw)
+{
+    std::uniform_int_distribution<typename Fixed::rep_type> dist {-max_raw, max_raw};
+    return Fixed::from_raw(dist(rng));
+}
+
+// The results of the integer arithmetic must match the exact decimal128_t results rounded to the scale
+template <typename Fixed>
+void test_arithmetic(const typename Fixed::rep_type max_raw)
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_value<Fixed>(max_raw)};
+        const auto rhs {random_value<Fixed>(max_raw)};
+        const auto dec_lhs {static_cast<decimal128_t>(lhs)};
+        const auto dec_rhs {static_cast<decimal128_t>(rhs)};
+
+        BOOST_TEST(Fixed{dec_lhs} == lhs);
+        BOOST_TEST(static_cast<decimal128_t>(lhs + rhs) == dec_lhs + dec_rhs);
+        BOOST_TEST(static_cast<decimal128_t>(lhs - rhs) == dec_lhs - dec_rhs);
+        BOOST_TEST(static_cast<decimal128_t>(-lhs) == -dec_lhs);
+        BOOST_TEST(lhs * rhs == Fixed{dec_lhs * dec_rhs});
+
+        if (rhs.raw() != 0)
+        {
+            BOOST_TEST(lhs / rhs == Fixed{dec_lhs / dec_rhs});
+        }
+
+        BOOST_TEST_EQ(lhs == rhs, dec_lhs == dec_rhs);
+        BOOST_TEST_EQ(lhs < rhs, dec_lhs < dec_rhs);
+        BOOST_TEST_EQ(lhs >= rhs, dec_lhs >= dec_rhs);
+
+        auto val {lhs};
+        val += rhs;
+        BOOST_TEST(val == lhs + rhs);
+        val -= rhs;
+        BOOST_TEST(val == lhs);
+        val *= rhs;
+        BOOST_TEST(val == lhs * rhs);
+    }
+}
+
+void test_rounding()
+{
+    const auto one {money{1}};
+    const auto three {money{3}};
+    const auto half_cent {money::from_raw(50)};
+
+    struct expected_results
+    {
+        rounding_mode round;
+        std::int64_t third;
+        std::int64_t neg_third;
+        std::int64_t product;
+        std::int64_t neg_product;
+    };
+
+    // 1 / 3 = 0.333..., and 0.5 * 0.05 = 0.025
+    const expected_results expected[] {
+        {rounding_mode::fe_dec_to_nearest, 33, -33, 2, -2},
+        {rounding_mode::fe_dec_to_nearest_from_zero, 33, -33, 3, -3},
+        {rounding_mode::fe_dec_toward_zero, 33, -33, 2, -2},
+        {rounding_mode::fe_dec_upward, 34, -33, 3, -2},
+        {rounding_mode::fe_dec_downward, 33, -34, 2, -3},
+    };
+
+    for (const auto& results : expected)
+    {
+        const rounding_scope scope {results.round};
+
+        BOOST_TEST_EQ((one / three).raw(), results.third);
+        BOOST_TEST_EQ((-one / three).raw(), results.neg_third);
+        BOOST_TEST_EQ((half_cent * money::from_raw(5)).raw(), results.product);
+        BOOST_TEST_EQ((-half_cent * money::from_raw(5)).raw(), results.neg_product);
+        BOOST_TEST_EQ(rescale<1>(money::from_raw(-25)).raw(), results.neg_product);
+    }
+
+    // Ties go to even by default
+    BOOST_TEST_EQ(rescale<0>(money::from_raw(250)).raw(), 2);
+    BOOST_TEST_EQ(rescale<0>(money::from_raw(350)).raw(), 4);
+    BOOST_TEST_EQ(rescale<0>(money::from_raw(-250)).raw(), -2);
+    BOOST_TEST_EQ(rescale<1>(money::from_raw(-251)).raw(), -25);
+    BOOST_TEST_EQ(rescale<4>(money::from_raw(-251)).raw(), -25100);
+    BOOST_TEST_EQ(rescale<2>(money::from_raw(-251)).raw(), -251);
+
+    BOOST_TEST((money{decimal64_t{12345, -4}} == money::from_raw(123)));
+    BOOST_TEST((money{decimal64_t{12355, -4}} == money::from_raw(124)));
+    BOOST_TEST((money{decimal64_t{-5, -3}} == money{0}));
+    BOOST_TEST((money{decimal64_t{1, -300}} == money{0}));
+    BOOST_TEST((money{decimal64_t{12, 3}} == money{12000}));
+}
+
+void test_conversions()
+{
+    // Every value of the representation is exact in decimal128_t, and below 10^16 in decimal64_t
+    const auto max_money {money::from_raw((std::numeric_limits<std::int64_t>::max)())};
+    BOOST_TEST(money{static_cast<decimal128_t>(max_money)} == max_money);
+    BOOST_TEST(money{static_cast<decimal128_t>(-max_money)} == -max_money);
+    BOOST_TEST((static_cast<decimal64_t>(money::from_raw(-9999999999999999)) == decimal64_t(-9999999999999999, -2)));
+    BOOST_TEST((static_cast<decimal32_t>(fixed_decimal<3, std::int32_t>::from_raw(1234567)) == decimal32_t(1234567, -3)));
+    BOOST_TEST((static_cast<decimal_fast64_t>(money::from_raw(-1)) == decimal_fast64_t(-1, -2)));
+    BOOST_TEST((money{decimal_fast128_t{-1, -2}} == money::from_raw(-1)));
+    BOOST_TEST(money{-7} == money::from_raw(-700));
+
+    errno = 0;
+    BOOST_TEST(money{std::numeric_limits<decimal64_t>::quiet_NaN()} == max_money);
+    BOOST_TEST_EQ(errno, EINVAL);
+
+    errno = 0;
+    BOOST_TEST(money{std::numeric_limits<decimal64_t>::infinity()} == max_money);
+    BOOST_TEST_EQ(errno, ERANGE);
+
+    errno = 0;
+    BOOST_TEST(money{-std::numeric_limits<decimal64_t>::infinity()} == -max_money);
+    BOOST_TEST_EQ(errno, ERANGE);
+
+    errno = 0;
+    BOOST_TEST((money{decimal128_t{1, 17}} == max_money));
+    BOOST_TEST_EQ(errno, ERANGE);
+
+    errno = 0;
+    BOOST_TEST((money{decimal128_t{-1, 17}} == -max_money));
+    BOOST_TEST_EQ(errno, ERANGE);
+
+    errno = 0;
+    BOOST_TEST((fixed_decimal<0, std::int32_t>{decimal64_t{-3, 9}}.raw() == -(std::numeric_limits<std::int32_t>::max)()));
+    BOOST_TEST_EQ(errno, ERANGE);
+
+    errno = 0;
+    BOOST_TEST((fixed_decimal<0, std::int32_t>{decimal64_t{-2, 9}}.raw() == -2000000000));
+    BOOST_TEST_EQ(errno, 0);
+}
+
+template <typename Fixed>
+void test_roundtrip(const char* str, const Fixed expected)
+{
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), expected)};
+    BOOST_TEST(r.ec == std::errc());
+    *r.ptr = '\0';
+    BOOST_TEST_CSTR_EQ(buffer, str);
+
+    Fixed val {};
+    const auto parsed {from_chars(str, str + std::strlen(str), val)};
+    BOOST_TEST(parsed.ec == std::errc());
+    BOOST_TEST(val == expected);
+}
+
+void test_charconv()
+{
+    test_roundtrip("0.00", money{0});
+    test_roundtrip("-0.05", money::from_raw(-5));
+    test_roundtrip("123.40", money::from_raw(12340));
+    test_roundtrip("-92233720368547758.07", money::from_raw(-(std::numeric_limits<std::int64_t>::max)()));
+    test_roundtrip("42", fixed_decimal<0>{42});
+    test_roundtrip("-0.0001", fixed_decimal<4, std::int32_t>::from_raw(-1));
+
+    char buffer[64] {};
+
+    // The buffer must hold every digit of the fraction
+    auto r {to_chars(buffer, buffer + 5, money::from_raw(-12345))};
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    r = to_chars(buffer, buffer + 7, money::from_raw(-12345));
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(r.ptr, buffer + 7);
+
+    r = to_chars(buffer, buffer + sizeof(buffer), money::from_raw(12340), chars_format::scientific);
+    BOOST_TEST(r.ec == std::errc());
+    *r.ptr = '\0';
+    BOOST_TEST_CSTR_EQ(buffer, "1.234e+02");
+
+    r = to_chars(buffer, buffer + sizeof(buffer), money::from_raw(12345), chars_format::fixed, 1);
+    BOOST_TEST(r.ec == std::errc());
+    *r.ptr = '\0';
+    BOOST_TEST_CSTR_EQ(buffer, "123.4");
+
+    // Extra digits are rounded, and errors leave the value unchanged
+    money val {};
+    const char* str {"1.005"};
+    BOOST_TEST(from_chars(str, str + std::strlen(str), val).ec == std::errc());
+    BOOST_TEST(val == money::from_raw(100));
+
+    str = "1e18";
+    BOOST_TEST(from_chars(str, str + std::strlen(str), val).ec == std::errc::result_out_of_range);
+    BOOST_TEST(val == money::from_raw(100));
+
+    str = "nan";
+    BOOST_TEST(from_chars(str, str + std::strlen(str), val).ec == std::errc::invalid_argument);
+    BOOST_TEST(val == money::from_raw(100));
+
+    str = "abc";
+    BOOST_TEST(from_chars(str, str + std::strlen(str), val).ec == std::errc::invalid_argument);
+    BOOST_TEST(val == money::from_raw(100));
+
+    // Up to the 34 digits of decimal128_t the value is rounded once
+    str = "1.014999999999999999999999999999999";
+    BOOST_TEST(from_chars(str, str + std::strlen(str), val).ec == std::errc());
+    BOOST_TEST(val == money::from_raw(101));
+
+    // Beyond them it is rounded to 34 digits first, here up to the tie 1.015, which then rounds to even
+    str = "1.0149999999999999999999999999999999999";
+    BOOST_TEST(from_chars(str, str + std::strlen(str), val).ec == std::errc());
+    BOOST_TEST(val == money::from_raw(102));
+}
+
+void test_hash()
+{
+    const std::hash<money> hasher {};
+    BOOST_TEST_EQ(hasher(money{1}), hasher(money::from_raw(100)));
+    BOOST_TEST_EQ(hasher(money{1}), std::hash<std::int64_t>{}(100));
+    BOOST_TEST_NE(hasher(money{1}), hasher(money{-1}));
+}
+
+int main()
+{
+    test_arithmetic<money>(INT64_C(1000000000));
+    test_arithmetic<fixed_decimal<6>>(INT64_C(1000000000));
+    test_arithmetic<fixed_decimal<0>>(INT64_C(1000000000));
+    test_arithmetic<fixed_decimal<2, std::int32_t>>(INT32_C(400000));
+    test_arithmetic<fixed_decimal<4, std::int32_t>>(INT32_C(40000));
+    test_rounding();
+    test_conversions();
+    test_charconv();
+    test_hash();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,211 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_config.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024 >> 4U); // Number of trials
+#endif
+
+static std::mt19937_64 rng(42);
+
+// Operations between a decimal and an integer use the integer directly as a significand,
+// so the results must match the correctly rounded results of the exact operation.
+// For the 32 and 64-bit types the exact result is computed in decimal128_t,
+// so the exponent range is limited to sums that fit in 34 digits
+template <typename T, typename Integer>
+void test_against_wider(const int min_exp, const int max_exp)
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-99'999'999, 99'999'999);
+    std::uniform_int_distribution<int> exp_dist(min_exp, max_exp);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T val {sig_dist(rng), exp_dist(rng)};
+        auto int_val {static_cast<Integer>(rng())};
+        if (i % 2U == 0U)
+        {
+            int_val = static_cast<Integer>(int_val % 1000);
+        }
+
+        const auto wide_val {static_cast<decimal128_t>(val)};
+        const decimal128_t wide_int_val {int_val};
+
+        BOOST_TEST_EQ(val * int_val, static_cast<T>(wide_val * wide_int_val));
+        BOOST_TEST_EQ(int_val * val, static_cast<T>(wide_int_val * wide_val));
+        BOOST_TEST_EQ(val + int_val, static_cast<T>(wide_val + wide_int_val));
+        BOOST_TEST_EQ(int_val + val, static_cast<T>(wide_int_val + wide_val));
+        BOOST_TEST_EQ(val - int_val, static_cast<T>(wide_val - wide_int_val));
+        BOOST_TEST_EQ(int_val - val, static_cast<T>(wide_int_val - wide_val));
+
+        if (int_val != 0)
+        {
+            BOOST_TEST_EQ(val / int_val, static_cast<T>(wide_val / wide_int_val));
+        }
+    }
+}
+
+// The 128-bit types have no wider reference,
+// so multiplication and addition are checked against the same type operators
+template <typename T, typename Integer>
+void test_against_same_type()
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-99'999'999, 99'999'999);
+    std::uniform_int_distribution<int> exp_dist(-20, 20);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        auto val {T{sig_dist(rng), exp_dist(rng)}};
+        if (i % 3U == 0U)
+        {
+            val /= T{sig_dist(rng)};
+        }
+
+        const auto int_val {static_cast<Integer>(rng())};
+        const T dec_int_val {int_val};
+
+        BOOST_TEST_EQ(val * int_val, val * dec_int_val);
+        BOOST_TEST_EQ(int_val * val, dec_int_val * val);
+        BOOST_TEST_EQ(val + int_val, val + dec_int_val);
+        BOOST_TEST_EQ(val - int_val, val - dec_int_val);
+        BOOST_TEST_EQ(int_val - val, dec_int_val - val);
+    }
+}
+
+template <typename T>
+void test_division_rounding()
+{
+    // 2 / 3 rounds up in the last digit, -2 / 3 rounds away from zero
+    constexpr auto digits {std::numeric_limits<T>::digits10};
+    const T two_thirds {T{2} / 3};
+    const T neg_two_thirds {T{-2} / 3};
+    const T one_third {T{1} / 3};
+
+    BOOST_TEST_EQ(two_thirds, -neg_two_thirds);
+    BOOST_TEST(two_thirds > T(6666666, -7));
+    BOOST_TEST_EQ(one_third + one_third + one_third, T{1} - T(1, -digits));
+
+    // Exact quotients are unchanged
+    BOOST_TEST_EQ(T(125, -2) / 5, T(25, -2));
+    BOOST_TEST_EQ(T(-125, -2) / 5U, T(-25, -2));
+    BOOST_TEST_EQ(T{1} / 8, T(125, -3));
+}
+
+// Quotients of two decimals keep a sticky digit as well. Each case lies just past a tie,
+// or just past a representable value, by less than the last digit that the quotient kept before,
+// so it used to round to even, or not round up at all.
+template <typename T>
+void test_decimal_division_rounding(const std::int64_t tie_lhs, const std::int64_t tie_rhs, const std::int64_t tie_res,
+                                    const std::int64_t exact_lhs, const std::int64_t exact_rhs, const std::int64_t exact_res)
+{
+    constexpr auto exp {1 - std::numeric_limits<T>::digits10};
+
+    BOOST_TEST_EQ(T{tie_lhs} / T{tie_rhs}, T(tie_res, exp));
+    BOOST_TEST_EQ(T{-tie_lhs} / T{tie_rhs}, T(-tie_res, exp));
+    BOOST_TEST_EQ(T{exact_lhs} / T{exact_rhs}, T(exact_res - 1, exp));
+
+    BOOST_TEST_EQ(div<rounding_mode::fe_dec_upward>(T{exact_lhs}, T{exact_rhs}), T(exact_res, exp));
+    BOOST_TEST_EQ(div<rounding_mode::fe_dec_downward>(T{-exact_lhs}, T{exact_rhs}), T(-exact_res, exp));
+    BOOST_TEST_EQ(div<rounding_mode::fe_dec_toward_zero>(T{exact_lhs}, T{exact_rhs}), T(exact_res - 1, exp));
+
+    fesetround(rounding_mode::fe_dec_upward);
+    BOOST_TEST_EQ(T{exact_lhs} / T{exact_rhs}, T(exact_res, exp));
+    BOOST_TEST_EQ(decimal_divider<T>{T{exact_rhs}}(T{exact_lhs}), T(exact_res, exp));
+    fesetround(rounding_mode::fe_dec_default);
+
+    BOOST_TEST_EQ(decimal_divider<T>{T{tie_rhs}}(T{tie_lhs}), T(tie_res, exp));
+
+    // Random quotients against the quotient of decimal128_t, which has enough digits for these operands
+    std::uniform_int_distribution<std::int64_t> sig_dist(-99'999'999, 99'999'999);
+    std::uniform_int_distribution<int> exp_dist(-10, 10);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const T lhs {sig_dist(rng), exp_dist(rng)};
+        const T rhs {sig_dist(rng) | 1, exp_dist(rng)};
+
+        BOOST_TEST_EQ(lhs / rhs, static_cast<T>(static_cast<decimal128_t>(lhs) / static_cast<decimal128_t>(rhs)));
+    }
+}
+
+template <typename T>
+void test_special_values()
+{
+    const T inf {std::numeric_limits<T>::infinity()};
+    const T nan {std::numeric_limits<T>::quiet_NaN()};
+
+    BOOST_TEST(isinf(inf * 2));
+    BOOST_TEST(isnan(nan * 2));
+    BOOST_TEST(isinf(inf / 2));
+    BOOST_TEST(isnan(nan / 2));
+    BOOST_TEST(isinf(T{1} / 0));
+    BOOST_TEST(isinf(inf + 2));
+    BOOST_TEST(isnan(nan - 2));
+    BOOST_TEST(isnan(2 - nan));
+
+    BOOST_TEST(signbit(T{-1} * 0));
+    BOOST_TEST(!signbit(T{-1} * -1));
+    BOOST_TEST(signbit(T{1} / -2));
+    BOOST_TEST_EQ(T(5, -1) + 1, T(15, -1));
+    BOOST_TEST_EQ(T(5, -1) - 1, T(-5, -1));
+    BOOST_TEST_EQ(1 - T(5, -1), T(5, -1));
+
+    // Results that leave the exponent range still overflow
+    BOOST_TEST(isinf((std::numeric_limits<T>::max)() * 10));
+    BOOST_TEST_EQ((std::numeric_limits<T>::max)() * 1, (std::numeric_limits<T>::max)());
+}
+
+int main()
+{
+    test_against_wider<decimal32_t, int>(-8, 10);
+    test_against_wider<decimal32_t, short>(-8, 10);
+    test_against_wider<decimal32_t, std::uint64_t>(-8, 10);
+    test_against_wider<decimal32_t, std::int64_t>(-14, 20);
+    test_against_wider<decimal64_t, int>(-15, 10);
+    test_against_wider<decimal64_t, std::uint32_t>(-15, 10);
+    test_against_wider<decimal64_t, std::int64_t>(-14, 20);
+
+    test_against_wider<decimal_fast32_t, int>(-8, 10);
+    test_against_wider<decimal_fast32_t, std::uint64_t>(-8, 10);
+    test_against_wider<decimal_fast64_t, int>(-15, 10);
+    test_against_wider<decimal_fast64_t, std::int64_t>(-14, 20);
+
+    test_against_same_type<decimal128_t, int>();
+    test_against_same_type<decimal128_t, std::uint64_t>();
+    test_against_same_type<decimal128_t, std::int64_t>();
+    test_against_same_type<decimal_fast128_t, int>();
+    test_against_same_type<decimal_fast128_t, std::int64_t>();
+
+    test_division_rounding<decimal32_t>();
+    test_division_rounding<decimal64_t>();
+    test_division_rounding<decimal128_t>();
+    test_division_rounding<decimal_fast32_t>();
+    test_division_rounding<decimal_fast64_t>();
+    test_division_rounding<decimal_fast128_t>();
+
+    test_decimal_division_rounding<decimal32_t>(1'166'670, 1'000'003, 1'166'667, 1'333'337, 1'000'003, 1'333'334);
+    test_decimal_division_rounding<decimal_fast32_t>(1'166'670, 1'000'003, 1'166'667, 1'333'337, 1'000'003, 1'333'334);
+    test_decimal_division_rounding<decimal64_t>(1'928'571'428'571'442, 1'000'000'000'000'007, 1'928'571'428'571'429,
+                                                1'333'333'333'333'337, 1'000'000'000'000'003, 1'333'333'333'333'334);
+    test_decimal_division_rounding<decimal_fast64_t>(1'928'571'428'571'442, 1'000'000'000'000'007, 1'928'571'428'571'429,
+                                                     1'333'333'333'333'337, 1'000'000'000'000'003, 1'333'333'333'333'334);
+
+    test_special_values<decimal32_t>();
+    test_special_values<decimal64_t>();
+    test_special_values<decimal128_t>();
+    test_special_values<decimal_fast32_t>();
+    test_special_values<decimal_fast64_t>();
+    test_special_values<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,217 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+static std::mt19937_64 rng {42};
+
+template <typename T>
+T random_value(const int max_exp)
+{
+    std::uniform_int_distribution<std::uint64_t> sig_dist {0U, UINT64_C(9999999999999999)};
+    std::uniform_int_distribution<int> exp_dist {-max_exp, max_exp};
+    std::uniform_int_distribution<int> sign_dist {0, 1};
+    return T{sig_dist(rng), exp_dist(rng), sign_dist(rng) == 1};
+}
+
+// The products of 64-bit significands are exact in decimal128_t.
+// This is the reference, since decimal_fast64_t multiplication is rounded from a truncated product.
+template <typename T>
+T rounded_product(const T lhs, const T rhs)
+{
+    return static_cast<T>(static_cast<decimal128_t>(lhs) * static_cast<decimal128_t>(rhs));
+}
+
+decimal128_t rounded_product(const decimal128_t lhs, const decimal128_t rhs)
+{
+    return lhs * rhs;
+}
+
+decimal_fast128_t rounded_product(const decimal_fast128_t lhs, const decimal_fast128_t rhs)
+{
+    return lhs * rhs;
+}
+
+// A single operation is rounded once either way, so the results are the same as the operators
+template <typename T>
+void test_single_operations(const int max_exp)
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_value<T>(max_exp)};
+        const auto rhs {random_value<T>(max_exp)};
+
+        BOOST_TEST_EQ(static_cast<T>(lazy(lhs) + lazy(rhs)), lhs + rhs);
+        BOOST_TEST_EQ(static_cast<T>(lazy(lhs) - rhs), lhs - rhs);
+        BOOST_TEST_EQ(static_cast<T>(lhs * lazy(rhs)), rounded_product(lhs, rhs));
+        BOOST_TEST_EQ(static_cast<T>(-lazy(lhs)), -lhs);
+        BOOST_TEST_EQ((+lazy(lhs)).evaluate(), lhs);
+
+        if (rhs != 0)
+        {
+            BOOST_TEST_EQ((lazy(lhs) / rhs).evaluate(), lhs / rhs);
+        }
+    }
+}
+
+// The exact results of decimal32_t expressions fit in decimal128_t, which is then rounded once
+template <typename T>
+void test_fused(const int max_exp)
+{
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto a {random_value<T>(max_exp)};
+        const auto b {random_value<T>(max_exp)};
+        const auto c {random_value<T>(max_exp)};
+        const auto d {random_value<T>(max_exp)};
+
+        const auto wide_a {static_cast<decimal128_t>(a)};
+        const auto wide_b {static_cast<decimal128_t>(b)};
+        const auto wide_c {static_cast<decimal128_t>(c)};
+        const auto wide_d {static_cast<decimal128_t>(d)};
+
+        BOOST_TEST_EQ(static_cast<T>(lazy(a) * b + c), static_cast<T>(wide_a * wide_b + wide_c));
+        BOOST_TEST_EQ(static_cast<T>(lazy(a) * b - lazy(c) * d), static_cast<T>(wide_a * wide_b - wide_c * wide_d));
+        BOOST_TEST_EQ(static_cast<T>(a - lazy(b) + c), static_cast<T>(wide_a - wide_b + wide_c));
+    }
+}
+
+template <typename T>
+void test_cancellation()
+{
+    constexpr int eps_exp {std::numeric_limits<T>::digits10 / 2 + 1};
+    const T one {1};
+    const T eps {1, -eps_exp};
+
+    // (1 + eps) * (1 - eps) is 1 - eps^2, which has more digits than the type so the operators round it to 1
+    BOOST_TEST_EQ((one + eps) * (one - eps) - one, T{0});
+    BOOST_TEST_EQ(static_cast<T>((lazy(one) + eps) * (lazy(one) - eps) - one), T(-1, -2 * eps_exp));
+
+    // Sums of many terms are rounded once, so the small terms are not lost
+    const auto sum {lazy(T{1, 10}) + T{1} + T{1} + T{1} - T{1, 10}};
+    BOOST_TEST_EQ(static_cast<T>(sum), T{3});
+
+    // Unless they are below the significand of the intermediate results
+    const auto lost_sum {lazy(T{1, 80}) + T{1} - T{1, 80}};
+    BOOST_TEST_EQ(static_cast<T>(lost_sum), T{0});
+
+    // The digits of c and f are discarded from both sums, and the difference cancels every digit above them.
+    // The exact result 5999 can not be recovered, so the expression is evaluated with the operators.
+    const T b {1, 2 * std::numeric_limits<T>::digits10 + 12};
+    const T c {999};
+    const T f {5, 3};
+    BOOST_TEST_EQ(static_cast<T>((lazy(b) + c) - (lazy(b) - f)), (b + c) - (b - f));
+    BOOST_TEST_EQ(static_cast<T>((lazy(b) + c) - b), (b + c) - b);
+    BOOST_TEST_EQ(static_cast<T>(((lazy(b) + c) - (lazy(b) - f)) * T(3) + T(1, 20)), ((b + c) - (b - f)) * T(3) + T(1, 20));
+}
+
+// The same with fewer digits above those of c and f
+void test_cancelled_sticky_digits()
+{
+    const decimal64_t b {1000000000000000, 24};
+    const decimal64_t c {999, 0};
+    const decimal64_t f {5, 3};
+    BOOST_TEST_EQ(static_cast<decimal64_t>((lazy(b) + c) - (lazy(b) - f)), (b + c) - (b - f));
+}
+
+template <typename T>
+void test_rounding()
+{
+    const T a {1234567, -6};
+    const T b {3, 0};
+    const T c {1, -8};
+
+    // a * b + c = 3.70370101, which needs a rounding at the seventh digit for decimal32_t
+    struct expected_results
+    {
+        rounding_mode round;
+        T result;
+        T neg_result;
+    };
+
+    const expected_results expected[] {
+        {rounding_mode::fe_dec_to_nearest, T{3703701, -6}, T{-3703701, -6}},
+        {rounding_mode::fe_dec_to_nearest_from_zero, T{3703701, -6}, T{-3703701, -6}},
+        {rounding_mode::fe_dec_toward_zero, T{3703701, -6}, T{-3703701, -6}},
+        {rounding_mode::fe_dec_upward, T{3703702, -6}, T{-3703701, -6}},
+        {rounding_mode::fe_dec_downward, T{3703701, -6}, T{-3703702, -6}},
+    };
+
+    for (const auto& results : expected)
+    {
+        const rounding_scope scope {results.round};
+
+        BOOST_TEST_EQ(static_cast<T>(lazy(a) * b + c), results.result);
+        BOOST_TEST_EQ(static_cast<T>(-(lazy(a) * b + c)), results.neg_result);
+
+        // The truncated digits of c must still move the result away from a tie
+        BOOST_TEST_EQ(static_cast<T>(lazy(T{1000000}) + T{5, -1} + T{1, -40}),
+                      results.round == rounding_mode::fe_dec_toward_zero || results.round == rounding_mode::fe_dec_downward ? T{1000000} : T{1000001});
+    }
+}
+
+template <typename T>
+void test_special_values()
+{
+    const auto inf {std::numeric_limits<T>::infinity()};
+    const auto qnan {std::numeric_limits<T>::quiet_NaN()};
+    const T one {1};
+
+    BOOST_TEST(isinf(static_cast<T>(lazy(inf) * one + one)));
+    BOOST_TEST(isnan(static_cast<T>(lazy(inf) - inf)));
+    BOOST_TEST(isnan(static_cast<T>(lazy(qnan) * one + one)));
+    BOOST_TEST(isinf(static_cast<T>(lazy(one) / T{0} + one)));
+
+    // Overflow and underflow of the final result
+    BOOST_TEST(isinf(static_cast<T>(lazy((std::numeric_limits<T>::max)()) * T{10} - one)));
+    BOOST_TEST_EQ(static_cast<T>(lazy(std::numeric_limits<T>::denorm_min()) * T{1, -1}), T{0});
+
+    // The sign of zero results follows the operators
+    BOOST_TEST(!signbit(static_cast<T>(lazy(one) - one)));
+    BOOST_TEST(signbit(static_cast<T>(lazy(-T{0}) * one)));
+    BOOST_TEST(signbit(static_cast<T>(lazy(-T{0}) - T{0})));
+    BOOST_TEST(!signbit(static_cast<T>(lazy(-T{0}) + T{0})));
+
+    {
+        const rounding_scope scope {rounding_mode::fe_dec_downward};
+        BOOST_TEST(signbit(static_cast<T>(lazy(one) - one)));
+        BOOST_TEST(signbit(static_cast<T>(lazy(-T{0}) + T{0})));
+    }
+}
+
+int main()
+{
+    test_single_operations<decimal32_t>(20);
+    test_single_operations<decimal64_t>(100);
+    test_single_operations<decimal128_t>(1000);
+    test_single_operations<decimal_fast32_t>(20);
+    test_single_operations<decimal_fast64_t>(100);
+    test_single_operations<decimal_fast128_t>(1000);
+
+    test_fused<decimal32_t>(4);
+    test_fused<decimal_fast32_t>(4);
+
+    test_cancellation<decimal32_t>();
+    test_cancellation<decimal64_t>();
+    test_cancellation<decimal128_t>();
+    test_cancellation<decimal_fast64_t>();
+    test_cancelled_sticky_digits();
+
+    test_rounding<decimal32_t>();
+    test_rounding<decimal_fast32_t>();
+
+    test_special_values<decimal32_t>();
+    test_special_values<decimal64_t>();
+    test_special_values<decimal128_t>();
+    test_special_values<decimal_fast32_t>();
+    test_special_values<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,122 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/decimal/parallel.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+// Enough values for several chunks, with a partial chunk at the end
+static constexpr std::size_t N = 3 * 65536 + 1000;
+
+template <typename DecimalType>
+void test_sum(const std::vector<DecimalType>& values)
+{
+    decimal_accumulator<DecimalType> acc {};
+    acc.accumulate(values.data(), values.size());
+    const auto serial {acc.result()};
+
+    for (const auto threads : {0U, 1U, 2U, 3U, 8U})
+    {
+        check_same(parallel_sum(values.data(), values.size(), threads), serial);
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    check_same(parallel_sum(std::span<const DecimalType>(values)), serial);
+    check_same(parallel_sum(values, 2U), serial);
+    #endif
+}
+
+template <typename DecimalType>
+void test_dot(const std::vector<DecimalType>& a, const std::vector<DecimalType>& b)
+{
+    const auto serial {dot(a.data(), b.data(), a.size())};
+
+    for (const auto threads : {0U, 1U, 2U, 3U, 8U})
+    {
+        check_same(parallel_dot(a.data(), b.data(), a.size(), threads), serial);
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+    check_same(parallel_dot(std::span<const DecimalType>(a), std::span<const DecimalType>(b)), serial);
+    check_same(parallel_dot(a, b, 2U), serial);
+
+    auto mutable_b {b};
+    check_same(parallel_dot(a, std::span<DecimalType>(mutable_b)), serial);
+    #endif
+}
+
+// Digits that are dropped from the running sums of different chunks cancel before the total is rounded
+template <typename DecimalType>
+void test_cancellation()
+{
+    constexpr auto digits {std::numeric_limits<DecimalType>::digits10};
+    const auto odd {DecimalType{1, digits - 1 + 65} + DecimalType{1, 65}};
+
+    // The small values come last in their chunks, after the running sum has moved up to the large ones
+    std::vector<DecimalType> values(N, DecimalType{0});
+    values[0] = odd;
+    values[10] = DecimalType{1, -10};
+    values[N / 2] = DecimalType{5, 64};
+    values[N / 2 + 10] = DecimalType{-2, -10};
+
+    const std::vector<DecimalType> ones(N, DecimalType{1});
+
+    for (const auto threads : {1U, 2U, 3U, 8U})
+    {
+        check_same(parallel_sum(values.data(), values.size(), threads), odd);
+        check_same(parallel_dot(values.data(), ones.data(), values.size(), threads), odd);
+    }
+}
+
+template <typename DecimalType>
+void test()
+{
+    const auto amounts {generate_values<DecimalType>(N, -2, -2, 9'999'999)};
+    const auto rates {generate_values<DecimalType>(N, -6, -6, 9'999'999)};
+    test_sum(amounts);
+    test_dot(amounts, rates);
+
+    // Exponents far enough apart that digits are dropped from the running sums
+    const auto mixed {generate_values<DecimalType>(N, -60, 60, 9'999'999)};
+    test_sum(mixed);
+    test_dot(mixed, amounts);
+
+    // Non-finite values in one of the chunks
+    auto special {amounts};
+    special[N / 2] = std::numeric_limits<DecimalType>::infinity();
+    test_sum(special);
+    test_dot(special, rates);
+
+    special[N - 1] = -std::numeric_limits<DecimalType>::infinity();
+    test_sum(special);
+
+    special[7] = std::numeric_limits<DecimalType>::quiet_NaN();
+    test_sum(special);
+    test_dot(rates, special);
+
+    // Empty and single chunk ranges
+    check_same(parallel_sum(amounts.data(), 0U), DecimalType{0});
+    check_same(parallel_dot(amounts.data(), rates.data(), 0U, 4U), DecimalType{0});
+    test_sum(std::vector<DecimalType>(amounts.begin(), amounts.begin() + 100));
+
+    test_cancellation<DecimalType>();
+}
+
+int main()
+{
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
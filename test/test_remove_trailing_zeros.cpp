@@ -7,6 +7,7 @@
 #include <array>
 #include <limits>
 #include <cstdint>
+#include <random>
 
 template <typename T>
 void test()
@@ -56,6 +57,74 @@ void test_extended()
     }
 }
 
+void test_u256()
+{
+    using boost::decimal::detail::u256;
+
+    for (std::size_t i {}; i < 78; ++i)
+    {
+        const auto val = boost::decimal::detail::pow10_256(i);
+        const auto temp {boost::decimal::detail::remove_trailing_zeros(val)};
+        BOOST_TEST(temp.trimmed_number == u256(1));
+        BOOST_TEST_EQ(temp.number_of_removed_zeros, i);
+    }
+}
+
+// Every count of trailing zeros in front of significands with and without trailing zeros of their own,
+// checked against removing them one at a time
+template <typename T>
+void test_random(const std::size_t max_zeros)
+{
+    std::mt19937_64 rng(42);
+
+    for (std::size_t zeros {}; zeros <= max_zeros; ++zeros)
+    {
+        for (int i {}; i < 64; ++i)
+        {
+            const auto digits {1U + rng() % (max_zeros + 1U - zeros)};
+            const auto lower {boost::decimal::detail::pow10_256(digits - 1U)};
+            const auto val {(lower + boost::decimal::detail::u256(rng()) % lower) * boost::decimal::detail::pow10_256(zeros)};
+
+            auto trimmed {val};
+            std::size_t removed {};
+            while (trimmed % boost::decimal::detail::u256(10U) == boost::decimal::detail::u256(0U))
+            {
+                trimmed = trimmed / boost::decimal::detail::u256(10U);
+                ++removed;
+            }
+
+            const auto temp {boost::decimal::detail::remove_trailing_zeros(static_cast<T>(val))};
+            BOOST_TEST(temp.trimmed_number == static_cast<T>(trimmed));
+            BOOST_TEST_EQ(temp.number_of_removed_zeros, removed);
+        }
+    }
+}
+
+#ifdef BOOST_DECIMAL_DETAIL_INT128_HAS_INT128
+
+void test_builtin()
+{
+    using boost::int128::detail::builtin_u128;
+
+    for (std::size_t i {}; i < 39; ++i)
+    {
+        const auto val {static_cast<builtin_u128>(boost::decimal::detail::impl::BOOST_DECIMAL_DETAIL_INT128_pow10[i])};
+
+        const auto temp {boost::decimal::detail::remove_trailing_zeros(val)};
+        BOOST_TEST(temp.trimmed_number == boost::int128::uint128_t(1));
+        BOOST_TEST_EQ(temp.number_of_removed_zeros, i);
+
+        if (i < 38)
+        {
+            const auto sevens {boost::decimal::detail::remove_trailing_zeros(val * 7U)};
+            BOOST_TEST(sevens.trimmed_number == boost::int128::uint128_t(7));
+            BOOST_TEST_EQ(sevens.number_of_removed_zeros, i);
+        }
+    }
+}
+
+#endif
+
 int main()
 {
     test<std::uint32_t>();
@@ -64,5 +133,13 @@ int main()
 
     test_extended();
 
+    test_u256();
+    test_random<boost::int128::uint128_t>(37);
+    test_random<boost::decimal::detail::u256>(76);
+
+    #ifdef BOOST_DECIMAL_DETAIL_INT128_HAS_INT128
+    test_builtin();
+    #endif
+
     return boost::report_errors();
 }
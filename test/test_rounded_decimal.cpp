@@ -0,0 +1,210 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+// The results must match those of the operators with Mode as the current rounding mode
+template <rounding_mode Mode, typename DecimalType>
+void check_operations(const DecimalType lhs, const DecimalType rhs)
+{
+    DecimalType sum {};
+    DecimalType difference {};
+    DecimalType product {};
+    DecimalType quotient {};
+
+    {
+        const rounding_scope scope {Mode};
+        sum = lhs + rhs;
+        difference = lhs - rhs;
+        product = lhs * rhs;
+        quotient = lhs / rhs;
+    }
+
+    check_same_encoding(add<Mode>(lhs, rhs), sum);
+    check_same_encoding(sub<Mode>(lhs, rhs), difference);
+    check_same_encoding(mul<Mode>(lhs, rhs), product);
+    check_same_encoding(div<Mode>(lhs, rhs), quotient);
+
+    using rounded = rounded_decimal<DecimalType, Mode>;
+    check_same_encoding((rounded{lhs} + rounded{rhs}).value(), sum);
+    check_same_encoding((rounded{lhs} - rhs).value(), difference);
+    check_same_encoding((lhs * rounded{rhs}).value(), product);
+    check_same_encoding(static_cast<DecimalType>(rounded{lhs} / rounded{rhs}), quotient);
+
+    rounded acc {lhs};
+    acc += rhs;
+    check_same_encoding(acc.value(), sum);
+    acc = lhs;
+    acc *= rhs;
+    check_same_encoding(acc.value(), product);
+}
+
+template <rounding_mode Mode, typename DecimalType>
+void test_values(const std::vector<DecimalType>& values)
+{
+    for (std::size_t i {}; i + 1U < values.size(); i += 2U)
+    {
+        check_operations<Mode>(values[i], values[i + 1U]);
+    }
+
+    for (const auto lhs : {DecimalType{0}, -DecimalType{0}, DecimalType{1}, -DecimalType{3},
+                           std::numeric_limits<DecimalType>::max(), std::numeric_limits<DecimalType>::min(),
+                           std::numeric_limits<DecimalType>::denorm_min(), std::numeric_limits<DecimalType>::epsilon(),
+                           std::numeric_limits<DecimalType>::infinity(), std::numeric_limits<DecimalType>::quiet_NaN()})
+    {
+        for (std::size_t i {}; i < 16U; ++i)
+        {
+            check_operations<Mode>(lhs, values[i]);
+            check_operations<Mode>(values[i], lhs);
+            check_operations<Mode>(-lhs, values[i]);
+        }
+    }
+}
+
+template <typename DecimalType>
+void test()
+{
+    std::vector<DecimalType> values {};
+
+    // Operands of similar magnitude, then with exponents far enough apart to round away the smaller one
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.push_back(random_value<DecimalType>(-10, 10));
+    }
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.push_back(random_value<DecimalType>(-60, 60));
+    }
+
+    // Results which overflow or are subnormal
+    const auto max_exp {std::numeric_limits<DecimalType>::max_exponent10};
+    for (std::size_t i {}; i < N / 4U; ++i)
+    {
+        values.push_back(random_value<DecimalType>(max_exp / 2 - 5, max_exp / 2 + 5));
+        values.push_back(random_value<DecimalType>(-max_exp / 2 - 5, -max_exp / 2 + 5));
+    }
+
+    test_values<rounding_mode::fe_dec_downward>(values);
+    test_values<rounding_mode::fe_dec_to_nearest>(values);
+    test_values<rounding_mode::fe_dec_to_nearest_from_zero>(values);
+    test_values<rounding_mode::fe_dec_toward_zero>(values);
+    test_values<rounding_mode::fe_dec_upward>(values);
+}
+
+// Operands with the same quantum keep it, whichever of the functions adds them
+template <typename DecimalType>
+void test_same_quantum()
+{
+    const std::vector<std::pair<DecimalType, DecimalType>> cases {
+        {DecimalType{1, 0}, DecimalType{2, 0}},
+        {DecimalType{125, -2}, DecimalType{-3, -2}},
+        {DecimalType{-7, 5}, DecimalType{-8, 5}},
+        {DecimalType{4, -3}, DecimalType{-4, -3}},
+    };
+
+    for (const auto& operands : cases)
+    {
+        const auto sum {operands.first + operands.second};
+        const auto difference {operands.first - operands.second};
+
+        check_same_encoding(add<rounding_mode::fe_dec_to_nearest>(operands.first, operands.second), sum);
+        check_same_encoding(sub<rounding_mode::fe_dec_to_nearest>(operands.first, operands.second), difference);
+        check_same_encoding(unchecked_add(operands.first, operands.second), sum);
+        check_same_encoding(unchecked_sub(operands.first, operands.second), difference);
+
+        using rounded = rounded_decimal<DecimalType, rounding_mode::fe_dec_to_nearest>;
+        check_same_encoding((rounded{operands.first} + rounded{operands.second}).value(), sum);
+    }
+}
+
+template <typename DecimalType>
+void test_directed()
+{
+    // The bounds of an interval enclose the exact result
+    const rounded_decimal<DecimalType, rounding_mode::fe_dec_downward> lower {DecimalType{1}};
+    const rounded_decimal<DecimalType, rounding_mode::fe_dec_upward> upper {DecimalType{1}};
+    const DecimalType tiny {1, -50};
+
+    BOOST_TEST_EQ((lower + tiny).value(), DecimalType{1});
+    BOOST_TEST((upper + tiny).value() > DecimalType{1});
+    BOOST_TEST((lower - tiny).value() < DecimalType{1});
+
+    // The rounding mode of the thread is not used or changed
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    const rounding_scope scope {rounding_mode::fe_dec_upward};
+    BOOST_TEST((lower + tiny).value() < DecimalType{1} + tiny);
+    BOOST_TEST(add<rounding_mode::fe_dec_to_nearest>(DecimalType{1}, tiny) < DecimalType{1} + tiny);
+    BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_upward);
+    #endif
+}
+
+// Subnormal results are rounded in Mode as well, with ties to even
+template <typename DecimalType>
+void test_subnormal()
+{
+    const auto denorm {std::numeric_limits<DecimalType>::denorm_min()};
+    const DecimalType zero {0};
+
+    BOOST_TEST_EQ(mul<rounding_mode::fe_dec_upward>(denorm, DecimalType(3, -3)), denorm);
+    BOOST_TEST_EQ(mul<rounding_mode::fe_dec_downward>(-denorm, DecimalType(3, -3)), -denorm);
+    BOOST_TEST_EQ(mul<rounding_mode::fe_dec_toward_zero>(denorm, DecimalType(9, -1)), zero);
+    BOOST_TEST_EQ(mul<rounding_mode::fe_dec_to_nearest>(denorm, DecimalType(5, -1)), zero);
+    BOOST_TEST_EQ(mul<rounding_mode::fe_dec_to_nearest>(denorm * 3, DecimalType(5, -1)), denorm * 2);
+    BOOST_TEST_EQ(mul<rounding_mode::fe_dec_to_nearest_from_zero>(denorm, DecimalType(5, -1)), denorm);
+    BOOST_TEST_EQ(div<rounding_mode::fe_dec_upward>(denorm, DecimalType{7}), denorm);
+
+    // The operators round them the same way
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    {
+        const rounding_scope scope {rounding_mode::fe_dec_upward};
+        BOOST_TEST_EQ(denorm * DecimalType(3, -3), denorm);
+        BOOST_TEST_EQ(denorm / DecimalType{7}, denorm);
+    }
+    BOOST_TEST_EQ(denorm * DecimalType(5, -1), zero);
+    BOOST_TEST_EQ((denorm * 3) * DecimalType(5, -1), denorm * 2);
+    #endif
+}
+
+int main()
+{
+    // Without it the operators always round in the compile time rounding mode
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    test<decimal32_t>();
+    test<decimal64_t>();
+    test<decimal128_t>();
+    test<decimal_fast32_t>();
+    test<decimal_fast64_t>();
+    test<decimal_fast128_t>();
+    #endif
+
+    test_same_quantum<decimal32_t>();
+    test_same_quantum<decimal64_t>();
+    test_same_quantum<decimal128_t>();
+    test_same_quantum<decimal_fast32_t>();
+    test_same_quantum<decimal_fast64_t>();
+    test_same_quantum<decimal_fast128_t>();
+
+    test_directed<decimal32_t>();
+    test_directed<decimal64_t>();
+    test_directed<decimal128_t>();
+    test_directed<decimal_fast32_t>();
+    test_directed<decimal_fast64_t>();
+    test_directed<decimal_fast128_t>();
+
+    test_subnormal<decimal32_t>();
+    test_subnormal<decimal64_t>();
+    test_subnormal<decimal128_t>();
+
+    return boost::report_errors();
+}
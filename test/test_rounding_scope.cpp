@@ -0,0 +1,108 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace boost::decimal;
+
+void test_scope()
+{
+    BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_to_nearest);
+
+    {
+        const rounding_scope outer {rounding_mode::fe_dec_upward};
+        BOOST_TEST(outer.previous() == rounding_mode::fe_dec_to_nearest);
+        BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_upward);
+        BOOST_TEST_EQ(decimal32_t(12'345'671, 0), decimal32_t(1'234'568, 1));
+
+        {
+            const rounding_scope inner {rounding_mode::fe_dec_downward};
+            BOOST_TEST(inner.previous() == rounding_mode::fe_dec_upward);
+            BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_downward);
+            BOOST_TEST_EQ(decimal32_t(12'345'679, 0), decimal32_t(1'234'567, 1));
+        }
+
+        BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_upward);
+
+        // A call to fesetround inside of a scope is undone with it
+        boost::decimal::fesetround(rounding_mode::fe_dec_toward_zero);
+    }
+
+    BOOST_TEST(boost::decimal::fegetround() == rounding_mode::fe_dec_to_nearest);
+}
+
+// Each thread rounds the same values in its own mode while the others change theirs
+void test_threads()
+{
+    constexpr rounding_mode modes[] {rounding_mode::fe_dec_downward, rounding_mode::fe_dec_to_nearest, rounding_mode::fe_dec_to_nearest_from_zero,
+                                     rounding_mode::fe_dec_toward_zero, rounding_mode::fe_dec_upward};
+
+    // Neither 1/3 + 2 * 10^-7 nor 12'345'665 fit in 7 digits, and the latter is a tie
+    const decimal32_t third {decimal32_t{1} / decimal32_t{3}};
+    const auto compute = [&]()
+    {
+        return std::vector<decimal32_t>{third + decimal32_t{2, -7}, -third - decimal32_t{2, -7}, decimal32_t{-12'345'665, 0}, decimal32_t{12'345'665, 0}};
+    };
+
+    const auto reference = [&](const rounding_mode round)
+    {
+        const rounding_scope scope {round};
+        return compute();
+    };
+
+    std::vector<std::vector<decimal32_t>> expected {};
+    for (const auto round : modes)
+    {
+        expected.push_back(reference(round));
+    }
+
+    std::atomic<int> failures {0};
+    std::vector<std::thread> threads {};
+    for (std::size_t i {}; i < 5U; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            const rounding_scope scope {modes[i]};
+
+            for (int j {}; j < 10000; ++j)
+            {
+                if (compute() != expected[i] || boost::decimal::fegetround() != modes[i])
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_TEST_EQ(failures.load(), 0);
+
+    // The results differ between the modes
+    BOOST_TEST(expected[0] != expected[4]);
+    BOOST_TEST(expected[1] != expected[2]);
+
+    // A new thread starts in the default mode regardless of the mode of the thread that started it
+    const rounding_scope scope {rounding_mode::fe_dec_upward};
+    rounding_mode new_thread_mode {rounding_mode::fe_dec_upward};
+    std::thread([&]() { new_thread_mode = boost::decimal::fegetround(); }).join();
+    BOOST_TEST(new_thread_mode == rounding_mode::fe_dec_to_nearest);
+}
+
+int main()
+{
+    #if !defined(BOOST_DECIMAL_NO_CONSTEVAL_DETECTION) && !defined(BOOST_DECIMAL_NO_THREAD_LOCAL)
+    test_scope();
+    test_threads();
+    #endif
+
+    return boost::report_errors();
+}
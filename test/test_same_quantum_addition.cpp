@@ -0,0 +1,122 @@
+// Copyright 2025 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_config.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024 >> 4U); // Number of trials
+#endif
+
+static std::mt19937_64 rng(42);
+
+// Operands with the same exponent are added on their encodings when the sum fits
+// the small significand encoding, otherwise the general path is taken.
+// Both must agree with the exact sum computed in decimal128_t.
+template <typename T>
+void test_random_same_quantum(const std::int64_t max_sig)
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-max_sig, max_sig);
+    std::uniform_int_distribution<int> exp_dist(-4, 4);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto exp {exp_dist(rng)};
+        const T lhs {sig_dist(rng), exp};
+        const T rhs {sig_dist(rng), exp};
+
+        const auto wide_lhs {static_cast<decimal128_t>(lhs)};
+        const auto wide_rhs {static_cast<decimal128_t>(rhs)};
+
+        BOOST_TEST_EQ(lhs + rhs, static_cast<T>(wide_lhs + wide_rhs));
+        BOOST_TEST_EQ(lhs - rhs, static_cast<T>(wide_lhs - wide_rhs));
+        BOOST_TEST_EQ(signbit(lhs + rhs), signbit(static_cast<T>(wide_lhs + wide_rhs)));
+    }
+}
+
+template <typename T>
+void test_exact_results()
+{
+    // IEEE 754-2008 6.1: the preferred exponent of an exact sum is the smaller operand exponent
+    const T sum {T(15, -1) + T(25, -1)};
+    BOOST_TEST_EQ(sum, T(4));
+    BOOST_TEST(samequantum(sum, T(40, -1)));
+
+    const T difference {T(-15, -1) - T(25, -1)};
+    BOOST_TEST_EQ(difference, T(-4));
+    BOOST_TEST(samequantum(difference, T(-40, -1)));
+
+    // The result takes the sign of the larger magnitude
+    BOOST_TEST_EQ(T(-15, -1) + T(25, -1), T(1));
+    BOOST_TEST_EQ(T(15, -1) - T(25, -1), T(-1));
+
+    // Sums of zeros keep their signs as in the general path
+    BOOST_TEST(signbit(T(-0.0) + T(-0.0)));
+    BOOST_TEST(!signbit(T(0) + T(0)));
+    BOOST_TEST(!signbit(T(-0.0) + T(0)));
+    BOOST_TEST(!signbit(T(5) - T(5)));
+
+    // Sums that no longer fit the small significand encoding are correct as well
+    constexpr auto digits {std::numeric_limits<T>::digits10};
+    const T big {detail::pow10(static_cast<std::uint64_t>(digits)) / 2U - 1U, 0};
+    BOOST_TEST_EQ(big + big, T(detail::pow10(static_cast<std::uint64_t>(digits)) - 2U, 0));
+    BOOST_TEST_EQ(big + big + big, T(3) * big);
+}
+
+template <typename T>
+void test_rounding_modes()
+{
+    const auto mode {boost::decimal::fegetround()};
+
+    // Exact sums do not depend on the rounding mode, and cancellation takes the general path
+    boost::decimal::fesetround(rounding_mode::fe_dec_downward);
+    BOOST_TEST_EQ(T(15, -1) + T(25, -1), T(4));
+    BOOST_TEST_EQ(T(5) - T(5), T(0));
+    BOOST_TEST_EQ(T(-15, -1) - T(-25, -1), T(1));
+
+    boost::decimal::fesetround(mode);
+}
+
+template <typename T>
+void test_copysign()
+{
+    const T inf {std::numeric_limits<T>::infinity()};
+    const T nan {std::numeric_limits<T>::quiet_NaN()};
+
+    BOOST_TEST_EQ(copysign(T(2), T(-1)), T(-2));
+    BOOST_TEST_EQ(copysign(T(-2), T(1)), T(2));
+    BOOST_TEST_EQ(copysign(T(-2), T(-1)), T(-2));
+    BOOST_TEST(signbit(copysign(inf, T(-1))));
+    BOOST_TEST(isinf(copysign(inf, T(-1))));
+    BOOST_TEST(signbit(copysign(nan, -inf)));
+    BOOST_TEST(isnan(copysign(nan, -inf)));
+    BOOST_TEST(!signbit(copysign(-nan, inf)));
+}
+
+int main()
+{
+    test_random_same_quantum<decimal32_t>(9'999'999);
+    test_random_same_quantum<decimal32_t>(4'000'000);
+    test_random_same_quantum<decimal64_t>(9'999'999'999'999'999);
+    test_random_same_quantum<decimal64_t>(4'000'000'000'000'000);
+
+    test_exact_results<decimal32_t>();
+    test_exact_results<decimal64_t>();
+
+    test_rounding_modes<decimal32_t>();
+    test_rounding_modes<decimal64_t>();
+
+    test_copysign<decimal32_t>();
+    test_copysign<decimal64_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,225 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_ENABLE_STATUS_FLAGS
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <thread>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+static std::mt19937_64 rng {42};
+
+constexpr auto all_except {status_flags::fe_dec_all_except};
+constexpr auto inexact {status_flags::fe_dec_inexact};
+
+// Returns the flags raised since the last call and lowers them
+status_flags raised()
+{
+    const auto flags {fetestexcept(all_except)};
+    feclearexcept(all_except);
+    return flags;
+}
+
+void test_flag_functions()
+{
+    feclearexcept(all_except);
+    BOOST_TEST(fetestexcept(all_except) == status_flags{});
+
+    BOOST_TEST(feraiseexcept(status_flags::fe_dec_overflow | inexact) == (status_flags::fe_dec_overflow | inexact));
+    BOOST_TEST(feraiseexcept(status_flags::fe_dec_invalid) == (status_flags::fe_dec_invalid | status_flags::fe_dec_overflow | inexact));
+    BOOST_TEST(fetestexcept(status_flags::fe_dec_overflow | status_flags::fe_dec_underflow) == status_flags::fe_dec_overflow);
+
+    BOOST_TEST(feclearexcept(inexact) == (status_flags::fe_dec_invalid | status_flags::fe_dec_overflow));
+    BOOST_TEST(feclearexcept(all_except) == status_flags{});
+
+    BOOST_TEST((~inexact | inexact) == all_except);
+}
+
+template <typename DecimalType>
+void test_exceptions()
+{
+    volatile int one_int {1};
+    volatile int three_int {3};
+    const DecimalType one {one_int};
+    const DecimalType three {three_int};
+    const DecimalType zero {0};
+    const auto max {std::numeric_limits<DecimalType>::max()};
+    const auto min {std::numeric_limits<DecimalType>::min()};
+    const auto inf {std::numeric_limits<DecimalType>::infinity()};
+
+    feclearexcept(all_except);
+
+    // Exact results raise nothing
+    BOOST_TEST_EQ(one + three, DecimalType{4});
+    BOOST_TEST_EQ(one - three, DecimalType{-2});
+    BOOST_TEST_EQ(one * three, DecimalType{3});
+    BOOST_TEST_EQ(three / DecimalType{4}, DecimalType(75, -2));
+    BOOST_TEST_EQ(one / DecimalType(one_int, -1), DecimalType{10});
+    BOOST_TEST(raised() == status_flags{});
+
+    // Results which must be rounded
+    BOOST_TEST(one / three > zero);
+    BOOST_TEST(raised() == inexact);
+    BOOST_TEST_EQ(one + DecimalType(1, -40), one);
+    BOOST_TEST(raised() == inexact);
+
+    // Flags stay raised until they are cleared
+    static_cast<void>(one / three);
+    static_cast<void>(one + three);
+    BOOST_TEST(fetestexcept(all_except) == inexact);
+    feclearexcept(all_except);
+
+    BOOST_TEST(isinf(max * three));
+    BOOST_TEST(raised() == (status_flags::fe_dec_overflow | inexact));
+    BOOST_TEST(isinf(-max - max));
+    BOOST_TEST(raised() == (status_flags::fe_dec_overflow | inexact));
+
+    BOOST_TEST(min / DecimalType{7} < min);
+    BOOST_TEST(raised() == (status_flags::fe_dec_underflow | inexact));
+    BOOST_TEST_EQ(min * DecimalType(1, -50), zero);
+    BOOST_TEST(raised() == (status_flags::fe_dec_underflow | inexact));
+
+    BOOST_TEST(isinf(one / zero));
+    BOOST_TEST(raised() == status_flags::fe_dec_divbyzero);
+    BOOST_TEST(isinf(one / 0));
+    BOOST_TEST(raised() == status_flags::fe_dec_divbyzero);
+    BOOST_TEST(isinf(1 / zero));
+    BOOST_TEST(raised() == status_flags::fe_dec_divbyzero);
+
+    BOOST_TEST(isnan(zero / zero));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    BOOST_TEST(isnan(inf / inf));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    BOOST_TEST(isnan(inf - inf));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    BOOST_TEST(isnan(-inf + inf));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    BOOST_TEST(isnan(inf * zero));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    BOOST_TEST(isnan(std::numeric_limits<DecimalType>::signaling_NaN() + one));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+
+    // Operations on infinities and quiet NaNs are exact
+    BOOST_TEST(isinf(inf + one));
+    BOOST_TEST(isinf(inf * three));
+    BOOST_TEST_EQ(one / inf, zero);
+    BOOST_TEST(isnan(std::numeric_limits<DecimalType>::quiet_NaN() * three));
+    BOOST_TEST(raised() == status_flags{});
+}
+
+template <typename DecimalType>
+void test_conversions()
+{
+    feclearexcept(all_except);
+
+    BOOST_TEST_EQ(static_cast<int>(DecimalType(12345, -2)), 123);
+    BOOST_TEST(raised() == status_flags{});
+    static_cast<void>(static_cast<int>(std::numeric_limits<DecimalType>::quiet_NaN()));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    static_cast<void>(static_cast<std::int32_t>(std::numeric_limits<DecimalType>::infinity()));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+    static_cast<void>(static_cast<int>(DecimalType(1, 20)));
+    BOOST_TEST(raised() == status_flags::fe_dec_invalid);
+
+    // Integers with more digits than the precision
+    BOOST_TEST_EQ(DecimalType{UINT64_C(1000000000000000000)}, DecimalType(1, 18));
+    BOOST_TEST(raised() == status_flags{});
+    static_cast<void>(DecimalType{UINT64_C(1234567890123456789)});
+    BOOST_TEST(raised() == (std::numeric_limits<DecimalType>::digits10 < 19 ? inexact : status_flags{}));
+
+    DecimalType val {};
+    BOOST_TEST(from_chars("1.5", val));
+    BOOST_TEST(raised() == status_flags{});
+    BOOST_TEST(from_chars("3.14159265358979323846264338327950288419716939937510", val));
+    BOOST_TEST(raised() == inexact);
+    BOOST_TEST(from_chars("1.000000000000000000000000000000000000000000000000000", val));
+    BOOST_TEST(raised() == status_flags{});
+    BOOST_TEST(from_chars("1e99999", val));
+    BOOST_TEST(isinf(val));
+    BOOST_TEST(raised() == (status_flags::fe_dec_overflow | inexact));
+}
+
+// A result is inexact exactly when it differs from the exact result, which fits in decimal128_t
+template <typename DecimalType>
+void test_inexact()
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist {1, 99'999'999};
+    std::uniform_int_distribution<int> exp_dist {-8, 8};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const DecimalType lhs {sig_dist(rng), exp_dist(rng)};
+        const DecimalType rhs {sig_dist(rng), exp_dist(rng)};
+        const auto exact_lhs {static_cast<decimal128_t>(lhs)};
+        const auto exact_rhs {static_cast<decimal128_t>(rhs)};
+        feclearexcept(all_except);
+
+        const auto sum {lhs + rhs};
+        BOOST_TEST_EQ(raised() == inexact, static_cast<decimal128_t>(sum) != exact_lhs + exact_rhs);
+
+        const auto difference {lhs - rhs};
+        BOOST_TEST_EQ(raised() == inexact, static_cast<decimal128_t>(difference) != exact_lhs - exact_rhs);
+
+        const auto product {lhs * rhs};
+        BOOST_TEST_EQ(raised() == inexact, static_cast<decimal128_t>(product) != exact_lhs * exact_rhs);
+
+        const auto quotient {lhs / rhs};
+        BOOST_TEST_EQ(raised() == inexact, static_cast<decimal128_t>(quotient) * exact_rhs != exact_lhs);
+    }
+}
+
+// Each thread has its own flags
+void test_threads()
+{
+    feclearexcept(all_except);
+    feraiseexcept(status_flags::fe_dec_overflow);
+
+    status_flags new_thread_flags {all_except};
+    std::thread([&]()
+    {
+        new_thread_flags = fetestexcept(all_except);
+        static_cast<void>(decimal32_t{1} / decimal32_t{0});
+    }).join();
+
+    BOOST_TEST(new_thread_flags == status_flags{});
+    BOOST_TEST(raised() == status_flags::fe_dec_overflow);
+}
+
+int main()
+{
+    // Flags can not be raised without it
+    #ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+    test_flag_functions();
+
+    test_exceptions<decimal32_t>();
+    test_exceptions<decimal64_t>();
+    test_exceptions<decimal128_t>();
+    test_exceptions<decimal_fast32_t>();
+    test_exceptions<decimal_fast64_t>();
+    test_exceptions<decimal_fast128_t>();
+
+    test_conversions<decimal32_t>();
+    test_conversions<decimal64_t>();
+    test_conversions<decimal128_t>();
+    test_conversions<decimal_fast32_t>();
+    test_conversions<decimal_fast64_t>();
+    test_conversions<decimal_fast128_t>();
+
+    test_inexact<decimal32_t>();
+    test_inexact<decimal64_t>();
+    test_inexact<decimal_fast32_t>();
+    test_inexact<decimal_fast64_t>();
+
+    #ifndef BOOST_DECIMAL_NO_THREAD_LOCAL
+    test_threads();
+    #endif
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "testing_values.hpp"
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+static constexpr std::size_t N = 1024;
+
+// For finite operands the results must match those of the operators
+template <typename DecimalType>
+void check_operations(const DecimalType lhs, const DecimalType rhs)
+{
+    check_same(unchecked_add(lhs, rhs), lhs + rhs);
+    check_same(unchecked_sub(lhs, rhs), lhs - rhs);
+    check_same(unchecked_mul(lhs, rhs), lhs * rhs);
+    check_same(unchecked_div(lhs, rhs), lhs / rhs);
+
+    BOOST_TEST_EQ(unchecked_equal(lhs, rhs), lhs == rhs);
+    BOOST_TEST_EQ(unchecked_equal(rhs, lhs), rhs == lhs);
+    BOOST_TEST_EQ(unchecked_less(lhs, rhs), lhs < rhs);
+    BOOST_TEST_EQ(unchecked_less(rhs, lhs), rhs < lhs);
+}
+
+template <typename DecimalType>
+void test_operations()
+{
+    constexpr auto max_exp {std::numeric_limits<DecimalType>::max_exponent10};
+    constexpr auto min_exp {std::numeric_limits<DecimalType>::min_exponent10};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto lhs {random_value<DecimalType>(-20, 20)};
+        const auto rhs {random_value<DecimalType>(-20, 20)};
+        check_operations(lhs, rhs);
+        check_operations(lhs, lhs);
+        check_operations(lhs, -lhs);
+    }
+
+    // Results near the limits of the type, including overflow to infinity and underflow
+    for (std::size_t i {}; i < N / 4U; ++i)
+    {
+        check_operations(random_value<DecimalType>(max_exp - 40, max_exp - 10), random_value<DecimalType>(10, 40));
+        check_operations(random_value<DecimalType>(min_exp + 10, min_exp + 40), random_value<DecimalType>(10, 40));
+    }
+
+    const DecimalType zero {0};
+    const DecimalType one {1};
+    const auto max {std::numeric_limits<DecimalType>::max()};
+    const auto min {std::numeric_limits<DecimalType>::min()};
+    const auto denorm_min {std::numeric_limits<DecimalType>::denorm_min()};
+
+    check_operations(zero, -zero);
+    check_operations(zero, one);
+    check_operations(-one, zero);
+    check_operations(max, max);
+    check_operations(-max, max);
+    check_operations(min, min);
+    check_operations(min, denorm_min);
+    check_operations(denorm_min, -denorm_min);
+    check_operations(DecimalType{1, 5}, DecimalType{100000});
+    check_operations(DecimalType{1, -5}, DecimalType{10, -6});
+}
+
+template <typename DecimalType>
+void test_to_integral()
+{
+    // Only values which the conversion operators convert without errors
+    std::uniform_int_distribution<std::int64_t> dist {-999999, 999999};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto int_val {dist(rng)};
+        const DecimalType val {int_val};
+        BOOST_TEST_EQ(unchecked_to_integral<std::int64_t>(val), int_val);
+        BOOST_TEST_EQ(unchecked_to_integral<int>(val), static_cast<int>(int_val));
+
+        const DecimalType scaled {int_val, -3};
+        BOOST_TEST_EQ(unchecked_to_integral<std::int64_t>(scaled), static_cast<std::int64_t>(scaled));
+        BOOST_TEST_EQ(unchecked_to_integral<std::uint32_t>(abs(scaled)), static_cast<std::uint32_t>(abs(scaled)));
+    }
+
+    BOOST_TEST_EQ(unchecked_to_integral<int>(DecimalType{0}), 0);
+    BOOST_TEST_EQ(unchecked_to_integral<int>(DecimalType{-999, -3}), 0);
+    BOOST_TEST_EQ(unchecked_to_integral<int>(DecimalType{-1999, -3}), -1);
+    BOOST_TEST_EQ(unchecked_to_integral<unsigned>(DecimalType{25, 1}), 250U);
+    BOOST_TEST_EQ(unchecked_to_integral<std::int64_t>(std::numeric_limits<DecimalType>::denorm_min()), 0);
+    BOOST_TEST_EQ(unchecked_to_integral<std::int64_t>(DecimalType{1, -200}), 0);
+}
+
+int main()
+{
+    test_operations<decimal32_t>();
+    test_operations<decimal64_t>();
+    test_operations<decimal128_t>();
+    test_operations<decimal_fast32_t>();
+    test_operations<decimal_fast64_t>();
+    test_operations<decimal_fast128_t>();
+
+    test_to_integral<decimal32_t>();
+    test_to_integral<decimal64_t>();
+    test_to_integral<decimal128_t>();
+    test_to_integral<decimal_fast32_t>();
+    test_to_integral<decimal_fast64_t>();
+    test_to_integral<decimal_fast128_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Random operands and result checks shared by the tests which compare an implementation against the operators
+
+#ifndef BOOST_DECIMAL_TESTING_VALUES_HPP
+#define BOOST_DECIMAL_TESTING_VALUES_HPP
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+static std::mt19937_64 rng {42};
+
+// The same value with the same sign, or NaN for both
+template <typename DecimalType>
+void check_same(const DecimalType lhs, const DecimalType rhs)
+{
+    if (isnan(lhs) || isnan(rhs))
+    {
+        BOOST_TEST(isnan(lhs) && isnan(rhs));
+    }
+    else
+    {
+        BOOST_TEST_EQ(lhs, rhs);
+        BOOST_TEST_EQ(signbit(lhs), signbit(rhs));
+    }
+}
+
+// The IEEE types must also give the same member of the cohort, so their encodings are compared
+template <typename DecimalType>
+void check_same_encoding(const DecimalType lhs, const DecimalType rhs)
+{
+    check_same(lhs, rhs);
+}
+
+inline void check_same_encoding(const boost::decimal::decimal32_t lhs, const boost::decimal::decimal32_t rhs)
+{
+    BOOST_TEST_EQ(to_bits(lhs), to_bits(rhs));
+}
+
+inline void check_same_encoding(const boost::decimal::decimal64_t lhs, const boost::decimal::decimal64_t rhs)
+{
+    BOOST_TEST_EQ(to_bits(lhs), to_bits(rhs));
+}
+
+inline void check_same_encoding(const boost::decimal::decimal128_t lhs, const boost::decimal::decimal128_t rhs)
+{
+    BOOST_TEST(to_bits(lhs) == to_bits(rhs));
+}
+
+// Significands uniform in [-max_sig, max_sig] and exponents uniform in [min_exp, max_exp]
+template <typename DecimalType>
+std::vector<DecimalType> generate_values(const std::size_t size, const int min_exp, const int max_exp,
+                                         const std::int64_t max_sig = 9'999'999'999'999'999)
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist {-max_sig, max_sig};
+    std::uniform_int_distribution<int> exp_dist {min_exp, max_exp};
+
+    std::vector<DecimalType> values(size);
+    for (auto& val : values)
+    {
+        val = DecimalType{sig_dist(rng), exp_dist(rng)};
+    }
+
+    return values;
+}
+
+// A finite value with up to digits10 significant digits, built digit by digit so that the 128-bit types get up to 34 digits
+template <typename DecimalType>
+DecimalType random_value(const int min_exp, const int max_exp)
+{
+    std::uniform_int_distribution<int> digits_dist {1, std::numeric_limits<DecimalType>::digits10};
+    std::uniform_int_distribution<int> exp_dist {min_exp, max_exp};
+    std::uniform_int_distribution<int> sign_dist {0, 1};
+    std::uniform_int_distribution<unsigned> digit_dist {0U, 9U};
+
+    DecimalType sig {0};
+    const auto digits {digits_dist(rng)};
+    for (int i {}; i < digits; ++i)
+    {
+        sig = sig * DecimalType{10} + DecimalType{digit_dist(rng)};
+    }
+
+    // Near the limits of the type the scaled value can overflow
+    const auto val {sig * DecimalType{1, exp_dist(rng)}};
+    if (!isfinite(val))
+    {
+        return random_value<DecimalType>(min_exp, max_exp);
+    }
+
+    return sign_dist(rng) == 1 ? -val : val;
+}
+
+#endif // BOOST_DECIMAL_TESTING_VALUES_HPP